@@ -71,7 +71,8 @@ Agnus::resetConfig()
 
         OPT_AGNUS_REVISION,
         OPT_SLOW_RAM_MIRROR,
-        OPT_PTR_DROPS
+        OPT_PTR_DROPS,
+        OPT_MEM_STATS
     };
 
     for (auto &option : options) {
@@ -87,6 +88,7 @@ Agnus::getConfigItem(Option option) const
         case OPT_AGNUS_REVISION:    return config.revision;
         case OPT_SLOW_RAM_MIRROR:   return config.slowRamMirror;
         case OPT_PTR_DROPS:         return config.ptrDrops;
+        case OPT_MEM_STATS:         return config.stats;
             
         default:
             fatalError;
@@ -129,6 +131,11 @@ Agnus::setConfigItem(Option option, i64 value)
 
             config.ptrDrops = value;
             return;
+
+        case OPT_MEM_STATS:
+
+            config.stats = value;
+            return;
             
         default:
             fatalError;
@@ -295,6 +302,9 @@ Agnus::executeUntilBusIsFree()
         // This variable counts the number of DMA cycles the CPU will be suspended
         DMACycle delay = 0;
 
+        // Remember the line the access has been issued in
+        auto vpos = pos.v;
+
         // Execute Agnus until the bus is free
         do {
 
@@ -308,6 +318,9 @@ Agnus::executeUntilBusIsFree()
 
         // Add wait states to the CPU
         cpu.addWaitStates(DMA_CYCLES(delay));
+
+        // Inform the DMA debugger
+        dmaDebugger.recordCpuWait(vpos, delay);
     }
 
     // Assign bus to the CPU
@@ -337,6 +350,12 @@ Agnus::recordRegisterChange(Cycle delay, u32 addr, u16 value, Accessor acc)
 void
 Agnus::executeUntil(Cycle cycle) {
 
+    // Determine the due slots if the DMA debugger records a timeline
+    u64 due = 0;
+    if (dmaDebugger.isRecordingTimeline()) {
+        for (isize i = 0; i < SLOT_COUNT; i++) if (trigger[i] <= cycle) due |= u64(1) << i;
+    }
+
     //
     // Check primary slots
     //
@@ -476,6 +495,9 @@ Agnus::executeUntil(Cycle cycle) {
         if (trigger[i] < next) next = trigger[i];
     }
     nextTrigger = next;
+
+    // Pass the serviced slots to the DMA debugger
+    if (due) dmaDebugger.recordEvents(due);
 }
 
 template <isize nr> void
@@ -593,8 +615,9 @@ Agnus::eolHandler()
 {
     assert(pos.h == HPOS_CNT_PAL || pos.h == HPOS_CNT_NTSC);
 
-    // Pass control to the DMA debugger
+    // Pass control to the DMA debugger and the OS debugger
     dmaDebugger.eolHandler();
+    osDebugger.eolHandler();
 
     // Move to the next line
     pos.eol();
@@ -638,6 +661,9 @@ Agnus::eofHandler()
     assert(pos.v == 0);
     assert(denise.lace() == pos.lofToggle);
 
+    // Switch the accuracy if warp mode has been switched on or off
+    amiga.adaptAccuracy();
+
     // Run the screen recorder
     denise.screenRecorder.vsyncHandler(clock - 50 * DMA_CYCLES(HPOS_CNT_PAL));
     
@@ -652,6 +678,9 @@ Agnus::eofHandler()
     controlPort1.joystick.eofHandler();
     controlPort2.joystick.eofHandler();
     retroShell.eofHandler();
+    mem.heatmap.eofHandler();
+    mem.histogram.eofHandler();
+    dmaDebugger.eofHandler();
 
     // Update statistics
     updateStats();
@@ -83,11 +83,12 @@ u16
 Agnus::doDiskDmaRead()
 {
     u16 result = mem.peek16 <ACCESSOR_AGNUS> (dskpt);
+    mem.heatmap.read <HEAT_DISK> (dskpt);
     dskpt += 2;
 
     busOwner[pos.h] = BUS_DISK;
     busValue[pos.h] = result;
-    stats.usage[BUS_DISK]++;
+    if (config.stats) stats.usage[BUS_DISK]++;
 
     return result;
 }
@@ -98,11 +99,12 @@ Agnus::doAudioDmaRead()
     constexpr BusOwner owner = BusOwner(BUS_AUD0 + channel);
     
     u16 result = mem.peek16 <ACCESSOR_AGNUS> (audpt[channel]);
+    mem.heatmap.read <HEAT_AUDIO> (audpt[channel]);
     audpt[channel] += 2;
 
     busOwner[pos.h] = owner;
     busValue[pos.h] = result;
-    stats.usage[owner]++;
+    if (config.stats) stats.usage[owner]++;
 
     return result;
 }
@@ -114,11 +116,12 @@ Agnus::doBitplaneDmaRead()
     constexpr BusOwner owner = BusOwner(BUS_BPL1 + bitplane);
     
     u16 result = mem.peek16 <ACCESSOR_AGNUS> (bplpt[bitplane]);
+    mem.heatmap.read <HEAT_BITPLANE> (bplpt[bitplane]);
     bplpt[bitplane] += 2;
 
     busOwner[pos.h] = owner;
     busValue[pos.h] = result;
-    stats.usage[owner]++;
+    if (config.stats) stats.usage[owner]++;
 
     return result;
 }
@@ -130,11 +133,12 @@ Agnus::doSpriteDmaRead()
     constexpr BusOwner owner = BusOwner(BUS_SPRITE0 + channel);
 
     u16 result = mem.peek16 <ACCESSOR_AGNUS> (sprpt[channel]);
+    mem.heatmap.read <HEAT_SPRITE> (sprpt[channel]);
     sprpt[channel] += 2;
 
     busOwner[pos.h] = owner;
     busValue[pos.h] = result;
-    stats.usage[owner]++;
+    if (config.stats) stats.usage[owner]++;
 
     return result;
 }
@@ -143,10 +147,11 @@ u16
 Agnus::doCopperDmaRead(u32 addr)
 {
     u16 result = mem.peek16 <ACCESSOR_AGNUS> (addr);
+    mem.heatmap.read <HEAT_COPPER> (addr);
 
     busOwner[pos.h] = BUS_COPPER;
     busValue[pos.h] = result;
-    stats.usage[BUS_COPPER]++;
+    if (config.stats) stats.usage[BUS_COPPER]++;
 
     return result;
 }
@@ -158,10 +163,11 @@ Agnus::doBlitterDmaRead(u32 addr)
     assert(busOwner[pos.h] == BUS_BLITTER);
 
     u16 result = mem.peek16 <ACCESSOR_AGNUS> (addr);
+    mem.heatmap.read <HEAT_BLITTER> (addr);
 
     busOwner[pos.h] = BUS_BLITTER;
     busValue[pos.h] = result;
-    stats.usage[BUS_BLITTER]++;
+    if (config.stats) stats.usage[BUS_BLITTER]++;
 
     return result;
 }
@@ -170,31 +176,34 @@ void
 Agnus::doDiskDmaWrite(u16 value)
 {
     mem.poke16 <ACCESSOR_AGNUS> (dskpt, value);
+    mem.heatmap.write <HEAT_DISK> (dskpt);
     dskpt += 2;
 
     busOwner[pos.h] = BUS_DISK;
     busValue[pos.h] = value;
-    stats.usage[BUS_DISK]++;
+    if (config.stats) stats.usage[BUS_DISK]++;
 }
 
 void
 Agnus::doCopperDmaWrite(u32 addr, u16 value)
 {
     mem.pokeCustom16<ACCESSOR_AGNUS>(addr, value);
+    mem.heatmap.write <HEAT_COPPER> (addr);
 
     busOwner[pos.h] = BUS_COPPER;
     busValue[pos.h] = value;
-    stats.usage[BUS_COPPER]++;
+    if (config.stats) stats.usage[BUS_COPPER]++;
 }
 
 void
 Agnus::doBlitterDmaWrite(u32 addr, u16 value)
 {
     mem.poke16 <ACCESSOR_AGNUS> (addr, value);
+    mem.heatmap.write <HEAT_BLITTER> (addr);
 
     assert(busOwner[pos.h] == BUS_BLITTER); // Bus is already allocated
     busValue[pos.h] = value;
-    stats.usage[BUS_BLITTER]++;
+    if (config.stats) stats.usage[BUS_BLITTER]++;
 }
 
 template u16 Agnus::doAudioDmaRead<0>();
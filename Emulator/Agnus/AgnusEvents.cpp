@@ -153,8 +153,13 @@ Agnus::scheduleNextREGEvent()
     // Determine when the next register change happens
     Cycle next = changeRecorder.trigger();
 
-    // Schedule a register change event for that cycle
-    if (next < trigger[SLOT_REG]) scheduleAbs<SLOT_REG>(next, REG_CHANGE);
+    /* Schedule a register change event for that cycle. If the slot has
+     * already been serviced, its trigger cycle lies in the past and has to
+     * be replaced. Otherwise, the REG slot would be due in every cycle.
+     */
+    if (next < trigger[SLOT_REG] || trigger[SLOT_REG] <= clock) {
+        scheduleAbs<SLOT_REG>(next, REG_CHANGE);
+    }
 }
 
 void
@@ -558,7 +563,7 @@ Agnus::serviceDASEvent(EventID id)
             busValue[0x05] = 0;
             busValue[pos.lol ? 0xE3 : 0xE2] = 0;
 
-            stats.usage[BUS_REFRESH] += 4;
+            if (config.stats) stats.usage[BUS_REFRESH] += 4;
             break;
 
         case DAS_D0:
@@ -742,6 +747,9 @@ Agnus::serviceDASEvent(EventID id)
 void
 Agnus::serviceINSEvent(EventID id)
 {    
+    // Make sure the inspected Blitter state and Chip Ram are up to date
+    blitter.finishAsyncBlit();
+
     switch (id) {
 
         case INS_AMIGA:
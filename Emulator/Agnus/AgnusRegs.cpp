@@ -21,6 +21,9 @@ Agnus::peekDMACONR() const
     
     assert((result & ((1 << 14) | (1 << 13))) == 0);
     
+    // A spy access reports an asynchronous blit as still running
+    if (blitter.isRunningAsync()) return result | (1 << 14);
+
     if (blitter.isBusy()) result |= (1 << 14);
     if (blitter.isZero()) result |= (1 << 13);
     
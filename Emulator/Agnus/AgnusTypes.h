@@ -442,6 +442,7 @@ typedef struct
     AgnusRevision revision;
     bool slowRamMirror;
     bool ptrDrops;
+    bool stats;
 }
 AgnusConfig;
 
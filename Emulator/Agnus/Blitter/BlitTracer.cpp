@@ -0,0 +1,273 @@
+// -----------------------------------------------------------------------------
+// This file is part of vAmiga
+//
+// Copyright (C) Dirk W. Hoffmann. www.dirkwhoffmann.de
+// Licensed under the GNU General Public License v3
+//
+// See https://www.gnu.org for license information
+// -----------------------------------------------------------------------------
+
+#include "config.h"
+#include "BlitTracer.h"
+#include "BlitterTypes.h"
+#include "Error.h"
+#include "IOUtils.h"
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <map>
+
+void
+BlitTracer::start()
+{
+    clear();
+    enabled = true;
+}
+
+void
+BlitTracer::stop()
+{
+    enabled = false;
+    open = false;
+}
+
+void
+BlitTracer::clear()
+{
+    records.clear();
+    chipRam.clear();
+    dropped = 0;
+    open = false;
+}
+
+isize
+BlitTracer::footprint() const
+{
+    return isize(records.capacity() * sizeof(BlitRecord) + chipRam.capacity());
+}
+
+void
+BlitTracer::takeSnapshot(const u8 *chip, isize size, u32 revision)
+{
+    chipRam.assign(chip, chip + size);
+    this->revision = revision;
+}
+
+void
+BlitTracer::beginBlit(const BlitRecord &record)
+{
+    open = false;
+    if (!enabled) return;
+
+    if (isize(records.size()) >= maxRecords) {
+
+        dropped++;
+        return;
+    }
+
+    records.push_back(record);
+    records.back().cycles = -1;
+    records.back().hostTime = 0;
+
+    // Only charge the time from now on to this blit
+    clock = util::Time::now();
+    open = true;
+}
+
+void
+BlitTracer::endBlit(i64 now)
+{
+    if (!open) return;
+
+    auto &record = records.back();
+    record.cycles = AS_DMA_CYCLES(now - record.clock);
+    if (depth) record.hostTime += (util::Time::now() - clock).asNanoseconds();
+
+    open = false;
+}
+
+void
+BlitTracer::resume()
+{
+    if (depth++ == 0) clock = util::Time::now();
+}
+
+void
+BlitTracer::pause()
+{
+    assert(depth > 0);
+
+    if (--depth == 0 && open) {
+        records.back().hostTime += (util::Time::now() - clock).asNanoseconds();
+    }
+}
+
+void
+BlitTracer::dump(std::ostream& os) const
+{
+    using namespace util;
+
+    os << tab("Recording");
+    os << bol(enabled) << std::endl;
+    os << tab("Blits");
+    os << dec(isize(records.size())) << std::endl;
+    os << tab("Dropped");
+    os << dec(dropped) << std::endl;
+
+    if (records.empty()) return;
+
+    struct Group { i64 blits = 0; i64 words = 0; i64 cycles = 0; i64 time = 0; };
+
+    auto add = [](Group &group, const BlitRecord &r) {
+
+        group.blits++;
+        group.words += r.bltsizeH * r.bltsizeV;
+        group.cycles += std::max(r.cycles, i64(0));
+        group.time += r.hostTime;
+    };
+
+    auto print = [&](const string &name, const Group &group) {
+
+        char line[80];
+        snprintf(line, sizeof(line), "%8lld  %10lld  %10lld  %10.3f  %8.2f",
+                 (long long)group.blits, (long long)group.words,
+                 (long long)group.cycles, group.time / 1000000.0,
+                 group.words ? double(group.time) / double(group.words) : 0.0);
+
+        os << tab(name) << line << std::endl;
+    };
+
+    // Group the blits by type and by the blit signature
+    Group types[3];
+    std::map<std::pair<u16, u16>, Group> signatures;
+
+    for (auto &r : records) {
+
+        bool line = r.bltcon1 & BLTCON1_LINE;
+        bool fill = !line && (r.bltcon1 & (BLTCON1_IFE | BLTCON1_EFE));
+
+        add(types[line ? 2 : fill ? 1 : 0], r);
+        add(signatures[{ u16(r.bltcon0 & 0x0FFF), u16(line ? 2 : fill ? 1 : 0) }], r);
+    }
+
+    os << std::endl;
+    os << tab("Type");
+    os << "   Blits       Words      Cycles   Host (ms)   ns/word" << std::endl;
+
+    print("Copy", types[0]);
+    print("Fill", types[1]);
+    print("Line", types[2]);
+
+    // List the signatures that consumed the most host time
+    std::vector<std::pair<i64, std::pair<u16, u16>>> sorted;
+    for (auto &it : signatures) sorted.push_back( { it.second.time, it.first } );
+    std::sort(sorted.begin(), sorted.end(), std::greater<>());
+
+    os << std::endl;
+    os << tab("Channels / minterm");
+    os << "   Blits       Words      Cycles   Host (ms)   ns/word" << std::endl;
+
+    for (isize i = 0; i < std::min(isize(sorted.size()), isize(16)); i++) {
+
+        auto con0 = sorted[i].second.first;
+        auto type = sorted[i].second.second;
+
+        char name[32];
+        snprintf(name, sizeof(name), "%s%s%s%s %02X %s",
+                 con0 & BLTCON0_USEA ? "A" : "-",
+                 con0 & BLTCON0_USEB ? "B" : "-",
+                 con0 & BLTCON0_USEC ? "C" : "-",
+                 con0 & BLTCON0_USED ? "D" : "-",
+                 con0 & 0xFF,
+                 type == 2 ? "line" : type == 1 ? "fill" : "copy");
+
+        print(name, signatures.at(sorted[i].second));
+    }
+}
+
+void
+BlitTracer::exportCSV(const string &path) const
+{
+    std::ofstream stream(path);
+    if (!stream.is_open()) throw VAError(ERROR_FILE_CANT_CREATE, path);
+
+    // Write the header
+    stream << "clock,level,bltcon0,bltcon1,width,height,";
+    stream << "bltapt,bltbpt,bltcpt,bltdpt,bltamod,bltbmod,bltcmod,bltdmod,";
+    stream << "bltafwm,bltalwm,bltadat,bltbdat,bltcdat,cycles,host_ns\n";
+
+    // Write a line for each blit
+    for (auto &r : records) {
+
+        char line[256];
+        snprintf(line, sizeof(line),
+                 "%lld,%d,0x%04x,0x%04x,%d,%d,"
+                 "0x%06x,0x%06x,0x%06x,0x%06x,%d,%d,%d,%d,"
+                 "0x%04x,0x%04x,0x%04x,0x%04x,0x%04x,%lld,%lld\n",
+                 (long long)r.clock, r.level, r.bltcon0, r.bltcon1,
+                 r.bltsizeH, r.bltsizeV,
+                 r.bltapt, r.bltbpt, r.bltcpt, r.bltdpt,
+                 r.bltamod, r.bltbmod, r.bltcmod, r.bltdmod,
+                 r.bltafwm, r.bltalwm, r.bltadat, r.bltbdat, r.bltcdat,
+                 (long long)r.cycles, (long long)r.hostTime);
+
+        stream << line;
+    }
+}
+
+void
+BlitTracer::exportTrace(const string &path) const
+{
+    std::ofstream stream(path, std::ios::binary);
+    if (!stream.is_open()) throw VAError(ERROR_FILE_CANT_CREATE, path);
+
+    BlitTraceHeader header = {
+
+        { 'V', 'A', 'B', 'L', 'I', 'T', 'S', 0 },
+        version,
+        revision,
+        u32(chipRam.size()),
+        u32(records.size())
+    };
+
+    stream.write((const char *)&header, sizeof(header));
+    stream.write((const char *)chipRam.data(), chipRam.size());
+    stream.write((const char *)records.data(), records.size() * sizeof(BlitRecord));
+}
+
+void
+BlitTracer::importTrace(const string &path, BlitTraceHeader &header,
+                        std::vector<u8> &ram, std::vector<BlitRecord> &records)
+{
+    std::ifstream stream(path, std::ios::binary);
+    if (!stream.is_open()) throw VAError(ERROR_FILE_NOT_FOUND, path);
+
+    // Read and check the header
+    stream.read((char *)&header, sizeof(header));
+    if (!stream || std::memcmp(header.magic, "VABLITS", 8) != 0 || header.version != version) {
+        throw VAError(ERROR_FILE_TYPE_MISMATCH, path);
+    }
+
+    // Reject Chip Ram sizes the Amiga cannot have and oversized traces
+    switch (header.chipSize) {
+
+        case KB(256): case KB(512): case MB(1): case MB(2): break;
+        default: throw VAError(ERROR_FILE_TYPE_MISMATCH, path);
+    }
+    if (header.count > maxRecords) throw VAError(ERROR_FILE_TYPE_MISMATCH, path);
+
+    // Read the Chip Ram snapshot and the records
+    ram.resize(header.chipSize);
+    records.resize(header.count);
+    stream.read((char *)ram.data(), ram.size());
+    stream.read((char *)records.data(), records.size() * sizeof(BlitRecord));
+    if (!stream) throw VAError(ERROR_FILE_TYPE_MISMATCH, path);
+
+    // Reject blit sizes the Blitter registers cannot hold
+    for (auto &r : records) {
+
+        if (r.bltsizeH < 1 || r.bltsizeH > 0x0800 || r.bltsizeV < 1 || r.bltsizeV > 0x8000) {
+            throw VAError(ERROR_FILE_TYPE_MISMATCH, path);
+        }
+    }
+}
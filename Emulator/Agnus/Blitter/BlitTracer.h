@@ -0,0 +1,201 @@
+// -----------------------------------------------------------------------------
+// This file is part of vAmiga
+//
+// Copyright (C) Dirk W. Hoffmann. www.dirkwhoffmann.de
+// Licensed under the GNU General Public License v3
+//
+// See https://www.gnu.org for license information
+// -----------------------------------------------------------------------------
+
+#pragma once
+
+#include "Types.h"
+#include "Exception.h"
+#include "Chrono.h"
+#include <vector>
+
+/* The blit tracer records a single entry for each blit the Blitter starts.
+ * Besides the register values that define the blit, each record holds the
+ * number of emulated DMA cycles that elapsed until the blit terminated and
+ * the host time the emulator has spent on emulating it. The host time covers
+ * the blit function of the FastBlitter as well as all micro-instructions
+ * executed by the SlowBlitter.
+ *
+ * The tracer is disabled by default. In this state, no memory is allocated
+ * and the Blitter only checks the enable flag when a blit starts or ends.
+ *
+ * Along with the first record, the tracer takes a snapshot of Chip Ram. The
+ * snapshot and the records can be saved as a binary trace file which allows
+ * all blits to be replayed outside the running emulator.
+ *
+ * File layout:
+ *
+ *     BlitTraceHeader
+ *     Chip Ram snapshot (BlitTraceHeader::chipSize bytes)
+ *     BlitRecord
+ *     BlitRecord
+ *     ...
+ */
+
+struct BlitTraceHeader
+{
+    // Magic bytes ("VABLITS")
+    char magic[8];
+
+    // Version of the file format
+    u32 version;
+
+    // The emulated Agnus revision (AgnusRevision)
+    u32 revision;
+
+    // Size of the Chip Ram snapshot in bytes
+    u32 chipSize;
+
+    // Number of records
+    u32 count;
+};
+
+struct BlitRecord
+{
+    // Blitter registers when the blit starts
+    u16 bltcon0;
+    u16 bltcon1;
+    u16 bltsizeH;
+    u16 bltsizeV;
+    u32 bltapt;
+    u32 bltbpt;
+    u32 bltcpt;
+    u32 bltdpt;
+    i16 bltamod;
+    i16 bltbmod;
+    i16 bltcmod;
+    i16 bltdmod;
+    u16 bltafwm;
+    u16 bltalwm;
+    u16 bltadat;
+    u16 bltbdat;
+    u16 bltcdat;
+
+    // Accuracy level the blit has been emulated with
+    u16 level;
+
+    // Master clock when the blit starts
+    i64 clock;
+
+    // Number of DMA cycles until the blit terminates (-1 if still running)
+    i64 cycles;
+
+    // Host time spent on emulating the blit in nanoseconds
+    i64 hostTime;
+};
+
+static_assert(sizeof(BlitTraceHeader) == 24);
+static_assert(sizeof(BlitRecord) == 72);
+
+class BlitTracer {
+
+public:
+
+    // Maximum number of records
+    static constexpr isize maxRecords = 1024 * 1024;
+
+    // File format version
+    static constexpr u32 version = 1;
+
+private:
+
+    // Indicates if blits are recorded
+    bool enabled = false;
+
+    // The recorded blits
+    std::vector<BlitRecord> records;
+
+    // Number of blits that didn't fit into the record buffer
+    i64 dropped = 0;
+
+    // Indicates if the latest record belongs to a running blit
+    bool open = false;
+
+    // Nesting depth of the host time measurement
+    isize depth = 0;
+
+    // Start of the current host time measurement
+    util::Time clock;
+
+    // Chip Ram contents before the first recorded blit
+    std::vector<u8> chipRam;
+
+    // Agnus revision when the snapshot was taken
+    u32 revision = 0;
+
+
+    //
+    // Controlling
+    //
+
+public:
+
+    // Starts recording (all records are deleted)
+    void start();
+
+    // Stops recording (the recorded data is kept)
+    void stop();
+
+    // Deletes all records
+    void clear();
+
+    // Returns true if blits are recorded
+    bool isEnabled() const { return enabled; }
+
+    // Returns the number of records
+    isize size() const { return isize(records.size()); }
+
+    // Returns the number of bytes allocated for the records
+    isize footprint() const;
+
+    // Prints a summary grouped by the type of the blit
+    void dump(std::ostream& os) const;
+
+
+    //
+    // Recording
+    //
+
+public:
+
+    // Returns true if the Chip Ram snapshot needs to be taken
+    bool needsSnapshot() const { return enabled && records.empty(); }
+
+    // Stores a snapshot of Chip Ram
+    void takeSnapshot(const u8 *chip, isize size, u32 revision);
+
+    // Adds a record for a blit that has just been started
+    void beginBlit(const BlitRecord &record);
+
+    // Completes the record of the running blit
+    void endBlit(i64 clock);
+
+    // Starts or stops measuring the host time
+    void resume();
+    void pause();
+
+
+    //
+    // Exporting
+    //
+
+public:
+
+    /* Writes all records into a CSV file. Register values and pointers are
+     * written in hexadecimal notation, all other values in decimal notation.
+     */
+    void exportCSV(const string &path) const throws;
+
+    // Writes the Chip Ram snapshot and all records into a binary trace file
+    void exportTrace(const string &path) const throws;
+
+    // Reads a binary trace file
+    static void importTrace(const string &path, BlitTraceHeader &header,
+                            std::vector<u8> &ram,
+                            std::vector<BlitRecord> &records) throws;
+};
@@ -0,0 +1,70 @@
+// -----------------------------------------------------------------------------
+// This file is part of vAmiga
+//
+// Copyright (C) Dirk W. Hoffmann. www.dirkwhoffmann.de
+// Licensed under the GNU General Public License v3
+//
+// See https://www.gnu.org for license information
+// -----------------------------------------------------------------------------
+
+#include "config.h"
+#include "BlitWorker.h"
+
+BlitWorker::~BlitWorker()
+{
+    if (!thread.joinable()) return;
+
+    // Terminate the worker thread
+    {   std::lock_guard<std::mutex> lock(mutex);
+        quit = true;
+    }
+    cond.notify_all();
+    thread.join();
+}
+
+void
+BlitWorker::run(std::function<void()> func)
+{
+    // Launch the worker thread if this is the first job
+    if (!thread.joinable()) thread = std::thread(&BlitWorker::workLoop, this);
+
+    {   std::lock_guard<std::mutex> lock(mutex);
+
+        assert(!busy);
+        job = std::move(func);
+        busy = true;
+    }
+    cond.notify_all();
+}
+
+bool
+BlitWorker::wait()
+{
+    std::unique_lock<std::mutex> lock(mutex);
+
+    if (!busy) return false;
+
+    cond.wait(lock, [this]() { return !busy; });
+    return true;
+}
+
+void
+BlitWorker::workLoop()
+{
+    std::unique_lock<std::mutex> lock(mutex);
+
+    while (true) {
+
+        cond.wait(lock, [this]() { return quit || busy; });
+
+        if (!busy) break;
+
+        // Run the job without holding the lock
+        lock.unlock();
+        job();
+        lock.lock();
+
+        busy = false;
+        cond.notify_all();
+    }
+}
@@ -0,0 +1,75 @@
+// -----------------------------------------------------------------------------
+// This file is part of vAmiga
+//
+// Copyright (C) Dirk W. Hoffmann. www.dirkwhoffmann.de
+// Licensed under the GNU General Public License v3
+//
+// See https://www.gnu.org for license information
+// -----------------------------------------------------------------------------
+
+#pragma once
+
+#include "Types.h"
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <thread>
+
+/* The blit worker executes FastBlitter jobs on a background thread. It is
+ * utilized by the Blitter to process large copy blits while the emulator
+ * thread continues to emulate the CPU and the other DMA channels.
+ *
+ * The worker processes a single job at a time. The thread is launched when
+ * the first job is handed over and terminated when the worker is destroyed.
+ * Handing over a job and waiting for its completion both lock the same
+ * mutex. Hence, all memory writes performed by a job are visible to the
+ * emulator thread once wait() has returned.
+ */
+
+class BlitWorker {
+
+    // The worker thread
+    std::thread thread;
+
+    // Synchronization primitives
+    std::mutex mutex;
+    std::condition_variable cond;
+
+    // The job to execute
+    std::function<void()> job;
+
+    // Indicates if a job has been handed over and is not yet completed
+    bool busy = false;
+
+    // Indicates if the worker thread should terminate
+    bool quit = false;
+
+
+    //
+    // Initializing
+    //
+
+public:
+
+    ~BlitWorker();
+
+
+    //
+    // Running jobs
+    //
+
+public:
+
+    // Hands over a job to the worker thread (no other job must be pending)
+    void run(std::function<void()> func);
+
+    /* Waits until the pending job has been completed. The function returns
+     * true if the calling thread had to wait for the worker thread.
+     */
+    bool wait();
+
+private:
+
+    // The main function of the worker thread
+    void workLoop();
+};
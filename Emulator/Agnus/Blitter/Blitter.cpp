@@ -13,6 +13,7 @@
 #include "Checksum.h"
 #include "IOUtils.h"
 #include "Thread.h"
+#include <random>
 
 Blitter::Blitter(Amiga& ref) : SubComponent(ref)
 {
@@ -51,13 +52,282 @@ Blitter::_initialize()
 void
 Blitter::_reset(bool hard)
 {
+    finishAsyncBlit();
+
     RESET_SNAPSHOT_ITEMS(hard)
 
     if (hard) {
         blitcount = 1;
         copycount = 0;
         linecount = 0;
+
+        // Wipe out previously recorded usage information
+        clearStats();
+    }
+}
+
+isize
+Blitter::_memoryFootprint() const
+{
+    return memguard.bytesize() + tracer.footprint();
+}
+
+void
+Blitter::startTracer()
+{
+    {   SUSPENDED
+
+        tracer.start();
+    }
+}
+
+void
+Blitter::stopTracer()
+{
+    {   SUSPENDED
+
+        tracer.stop();
+    }
+}
+
+void
+Blitter::replayTrace(const string &path, std::ostream& os)
+{
+    using namespace util;
+
+    if (!isPoweredOff()) throw VAError(ERROR_POWERED_ON);
+
+    BlitTraceHeader header;
+    std::vector<u8> ram;
+    std::vector<BlitRecord> records;
+
+    BlitTracer::importTrace(path, header, ram, records);
+
+    // Emulate the Agnus revision and Chip Ram size the trace was recorded with
+    amiga.configure(OPT_AGNUS_REVISION, header.revision);
+    amiga.configure(OPT_CHIP_RAM, header.chipSize / KB(1));
+    if (isize(ram.size()) != mem.getConfig().chipSize) {
+        throw VAError(ERROR_FILE_TYPE_MISMATCH, path);
+    }
+
+    // Each level is run multiple times and the fastest run is reported
+    constexpr isize runs = 3;
+
+    struct Result { i64 blits[3] = { }; i64 words[3] = { }; i64 time[3] = { }; };
+    Result results[3];
+    std::vector<u8> images[3];
+
+    auto savedLevel = config.accuracy;
+
+    // Grant the bus to the Blitter in every cycle
+    agnus.dmacon = DMAEN | BLTEN;
+    agnus.setBLS(false);
+
+    for (isize level = 0; level < 3; level++) {
+
+        config.accuracy = level;
+
+        for (isize run = 0; run < runs; run++) {
+
+            Result result;
+            std::memcpy(mem.chip, ram.data(), ram.size());
+
+            for (auto &r : records) {
+
+                bltcon0 = r.bltcon0;
+                bltcon1 = r.bltcon1;
+                bltsizeH = r.bltsizeH;
+                bltsizeV = r.bltsizeV;
+                bltapt = r.bltapt;
+                bltbpt = r.bltbpt;
+                bltcpt = r.bltcpt;
+                bltdpt = r.bltdpt;
+                bltamod = r.bltamod;
+                bltbmod = r.bltbmod;
+                bltcmod = r.bltcmod;
+                bltdmod = r.bltdmod;
+                bltafwm = r.bltafwm;
+                bltalwm = r.bltalwm;
+                anew = r.bltadat;
+                bnew = r.bltbdat;
+                chold = r.bltcdat;
+
+                auto start = Time::now();
+
+                // Run the blit to completion
+                prepareBlit();
+                beginBlit();
+
+                while (agnus.hasEvent<SLOT_BLT>()) {
+
+                    agnus.busOwner[agnus.pos.h] = BUS_NONE;
+                    serviceEvent();
+                }
+                finishAsyncBlit();
+
+                auto type = bltconLINE() ? 2 : bltconFE() ? 1 : 0;
+                result.blits[type]++;
+                result.words[type] += r.bltsizeH * r.bltsizeV;
+                result.time[type] += (Time::now() - start).asNanoseconds();
+            }
+
+            auto total = [](const Result &r) { return r.time[0] + r.time[1] + r.time[2]; };
+            if (run == 0 || total(result) < total(results[level])) results[level] = result;
+        }
+
+        images[level].assign(mem.chip, mem.chip + ram.size());
+    }
+
+    config.accuracy = savedLevel;
+
+    // Print the results
+    os << tab("Trace file") << path << std::endl;
+    os << tab("Blits") << dec(isize(records.size())) << std::endl;
+    os << tab("Chip Ram") << dec(isize(ram.size()) / KB(1)) << " KB" << std::endl;
+
+    for (isize level = 0; level < 3; level++) {
+
+        auto &result = results[level];
+
+        os << std::endl;
+        os << tab("Level " + std::to_string(level));
+        os << "   Blits       Words   Host (ms)   ns/word" << std::endl;
+
+        for (isize type = 0; type < 3; type++) {
+
+            char line[80];
+            snprintf(line, sizeof(line), "%8lld  %10lld  %10.3f  %8.2f",
+                     (long long)result.blits[type], (long long)result.words[type],
+                     result.time[type] / 1000000.0,
+                     result.words[type] ? double(result.time[type]) / double(result.words[type]) : 0.0);
+
+            os << tab(type == 2 ? "Line" : type == 1 ? "Fill" : "Copy") << line << std::endl;
+        }
+
+        // Compare the final Chip Ram contents with the SlowBlitter result
+        isize diffs = 0, first = -1;
+        for (isize i = 0; i < isize(ram.size()); i++) {
+
+            if (images[level][i] != images[2][i]) {
+                if (first < 0) first = i;
+                diffs++;
+            }
+        }
+
+        os << tab("Result");
+        if (diffs == 0) {
+            os << (level == 2 ? "Reference" : "Identical") << std::endl;
+        } else {
+            os << dec(diffs) << " bytes differ (first at " << hex(6, u64(first)) << ")" << std::endl;
+        }
+    }
+}
+
+void
+Blitter::selfTest(isize count, std::ostream& os)
+{
+    using namespace util;
+
+    if (!isPoweredOff()) throw VAError(ERROR_POWERED_ON);
+
+    constexpr u32 seed = 1;
+    std::mt19937 rng(seed);
+
+    auto chipSize = mem.getConfig().chipSize;
+    std::vector<u8> ram(chipSize), image(chipSize);
+    for (auto &byte : ram) byte = u8(rng());
+
+    // The Blitter state that is compared in addition to Chip Ram
+    auto state = [&]() {
+        return std::vector<i64> {
+            bltapt, bltbpt, bltcpt, bltdpt, aold, bold, ahold, bhold, chold, dhold,
+            anew, bnew, bzero, mem.dataBus
+        };
+    };
+
+    auto savedConfig = config;
+    config.accuracy = 0;
+    config.async = false;
+
+    // Grant the bus to the Blitter in every cycle
+    agnus.dmacon = DMAEN | BLTEN;
+    agnus.setBLS(false);
+
+    isize fillBlits = 0, failures = 0;
+    auto simdRows = stats.simdRows;
+
+    for (isize i = 0; i < count; i++) {
+
+        // Pick a random copy blit. The special kernels are chosen more often.
+        static const u8 minterms[] = { 0xCA, 0xEA, 0xF0, 0xFC, 0x0F, 0x5A };
+        u8 lf = (rng() & 1) ? minterms[rng() % 6] : u8(rng());
+        u16 con0 = u16((rng() & 0xF000) | (rng() & 0x0F00) | lf);
+        u16 con1 = u16(rng() & (BLTCON1_BSH | BLTCON1_EFE | BLTCON1_IFE | BLTCON1_FCI | BLTCON1_DESC));
+        if ((con1 & BLTCON1_EFE) && (con1 & BLTCON1_IFE)) con1 &= ~BLTCON1_EFE;
+
+        u16 sizeH = u16(1 + rng() % 96);
+        u16 sizeV = u16(1 + rng() % 32);
+        u32 ptr[4]; i16 mod[4];
+        for (isize j = 0; j < 4; j++) {
+            ptr[j] = u32(rng() % chipSize) & ~1;
+            mod[j] = i16(i32(rng() % 129) - 64) & ~1;
+        }
+        u16 afwm = u16(rng()), alwm = u16(rng());
+        u16 adat = u16(rng()), bdat = u16(rng()), cdat = u16(rng());
+
+        if (con1 & (BLTCON1_EFE | BLTCON1_IFE)) fillBlits++;
+
+        // Run the blit with and without the SIMD kernels
+        std::vector<i64> results[2];
+
+        for (isize pass = 0; pass < 2; pass++) {
+
+            std::memcpy(mem.chip, ram.data(), chipSize);
+
+            bltcon0 = con0;
+            bltcon1 = con1;
+            bltsizeH = sizeH;
+            bltsizeV = sizeV;
+            bltapt = ptr[0]; bltbpt = ptr[1]; bltcpt = ptr[2]; bltdpt = ptr[3];
+            bltamod = mod[0]; bltbmod = mod[1]; bltcmod = mod[2]; bltdmod = mod[3];
+            bltafwm = afwm;
+            bltalwm = alwm;
+            anew = adat;
+            bnew = bdat;
+            chold = cdat;
+            mem.dataBus = 0;
+            simdEnabled = pass == 0;
+
+            prepareBlit();
+            beginBlit();
+
+            while (agnus.hasEvent<SLOT_BLT>()) {
+
+                agnus.busOwner[agnus.pos.h] = BUS_NONE;
+                serviceEvent();
+            }
+
+            results[pass] = state();
+            if (pass == 0) image.assign(mem.chip, mem.chip + chipSize);
+        }
+
+        if (results[0] == results[1] && std::memcmp(image.data(), mem.chip, chipSize) == 0) continue;
+
+        if (failures++ < 8) {
+
+            os << "Blit " << dec(i) << ": BLTCON0 = " << hex(con0) << " BLTCON1 = " << hex(con1);
+            os << " Size = " << dec(sizeH) << " x " << dec(sizeV) << std::endl;
+        }
     }
+
+    simdEnabled = true;
+    config = savedConfig;
+
+    os << tab("Random seed") << dec(seed) << std::endl;
+    os << tab("Copy blits") << dec(count) << std::endl;
+    os << tab("SIMD rows") << dec(stats.simdRows - simdRows) << std::endl;
+    os << tab("Fill blits") << dec(fillBlits) << std::endl;
+    os << tab("Mismatches") << dec(failures) << std::endl;
 }
 
 void
@@ -78,7 +348,8 @@ Blitter::resetConfig()
 
     std::vector <Option> options = {
         
-        OPT_BLITTER_ACCURACY
+        OPT_BLITTER_ACCURACY,
+        OPT_BLITTER_ASYNC
     };
 
     for (auto &option : options) {
@@ -92,6 +363,7 @@ Blitter::getConfigItem(Option option) const
     switch (option) {
             
         case OPT_BLITTER_ACCURACY: return config.accuracy;
+        case OPT_BLITTER_ASYNC: return config.async;
         
         default:
             fatalError;
@@ -113,6 +385,15 @@ Blitter::setConfigItem(Option option, i64 value)
             config.accuracy = (isize)value;
             return;
         }
+        case OPT_BLITTER_ASYNC:
+        {
+#ifdef __EMSCRIPTEN__
+            if (value) throw VAError(ERROR_OPT_UNSUPPORTED);
+#endif
+            SUSPENDED
+            config.async = (bool)value;
+            return;
+        }
         default:
             fatalError;
     }
@@ -502,7 +783,24 @@ Blitter::prepareBlit()
 void
 Blitter::beginBlit()
 {
-    auto level = config.accuracy;
+    auto level = amiga.inReducedAccuracyMode() ? 0 : config.accuracy;
+
+    // Wait until the previous blit has been finished by the worker thread
+    finishAsyncBlit();
+
+    // Record the blit if requested
+    if (tracer.isEnabled()) {
+
+        if (tracer.needsSnapshot()) {
+            tracer.takeSnapshot(mem.chip, mem.getConfig().chipSize, agnus.getConfig().revision);
+        }
+        tracer.beginBlit(BlitRecord {
+            bltcon0, bltcon1, bltsizeH, bltsizeV,
+            bltapt, bltbpt, bltcpt, bltdpt,
+            bltamod, bltbmod, bltcmod, bltdmod,
+            bltafwm, bltalwm, anew, bnew, chold,
+            u16(level), agnus.clock, -1, 0 });
+    }
 
     if (bltconLINE()) {
 
@@ -542,6 +840,10 @@ Blitter::beginBlit()
                 bltconDESC() ? "D" : "", bltconFE() ? "F" : "");
         }
 
+        // Record the minterm
+        stats.blits[u8(bltcon0)]++;
+        stats.words[u8(bltcon0)] += bltsizeH * bltsizeV;
+
         beginCopyBlit(level);
     }
 }
@@ -608,6 +910,9 @@ Blitter::endBlit()
     
     running = false;
     if constexpr (BLT_MEM_GUARD) blitcount++;
+
+    // Complete the trace record
+    if (tracer.isEnabled()) tracer.endBlit(agnus.clock);
     
     // Clear the Blitter slot
     agnus.cancel<SLOT_BLT>();
@@ -10,6 +10,8 @@
 #pragma once
 
 #include "BlitterTypes.h"
+#include "BlitTracer.h"
+#include "BlitWorker.h"
 #include "Memory.h"
 #include "AgnusTypes.h"
 #include "SubComponent.h"
@@ -26,6 +28,14 @@
  *          Uses up bus cycles like the real Blitter does.
  *
  * Level 0 and 1 invoke the FastBlitter. Level 2 invokes the SlowBlitter.
+ *
+ * If OPT_BLITTER_ASYNC is enabled, large level 0 copy blits are processed
+ * by a worker thread. The emulator thread continues as if the blit had
+ * already terminated and waits for the worker thread as soon as it accesses
+ * an affected memory area or a Blitter register. Hence, the emulation result
+ * is the same as with synchronous blits. Spy accesses never wait for the
+ * worker thread. They are meant to be issued from outside the run loop,
+ * which finishes all asynchronous blits before it returns.
  */
 
 class Blitter : public SubComponent
@@ -38,6 +48,9 @@ class Blitter : public SubComponent
     // Result of the latest inspection
     mutable BlitterInfo info = {};
 
+    // Usage profile
+    BlitterStats stats = {};
+
     // The fill pattern lookup tables
     u8 fillPattern[2][2][256];     // [inclusive/exclusive][carry in][data]
     u8 nextCarryIn[2][256];        // [carry in][data]
@@ -91,6 +104,39 @@ class Blitter : public SubComponent
     // The Fast Blitter's blit functions
     void (Blitter::*blitfunc[32])(void);
 
+    // Maximum number of words in a single row
+    static constexpr isize maxRowWords = 2048;
+
+    // Minimum number of words in a row that is processed with SIMD operations
+    static constexpr isize minSimdWords = 4;
+
+    // Minimum number of words in a blit that is processed asynchronously
+    static constexpr isize minAsyncWords = 8192;
+
+    // The worker thread for asynchronous blits
+    BlitWorker worker;
+
+    // Indicates if the worker thread is processing a blit
+    bool asyncBlit = false;
+
+    // Indicates if rows may be processed with SIMD operations (see selfTest)
+    bool simdEnabled = true;
+
+    // Chip Ram areas read and written by the asynchronous blit [lo; hi)
+    i64 asyncSrc[2];
+    i64 asyncDst[2];
+
+    // The value the asynchronous blit leaves on the data bus
+    u16 asyncData;
+
+    /* Statistics of the latest fast copy blit. The worker thread must not
+     * touch the stats variable, which is read by the GUI. Hence, a copy blit
+     * records its statistics here and mergeCopyStats() adds them to stats
+     * in the emulator thread.
+     */
+    isize copyMinterm = -1;
+    isize copySimdRows = 0;
+
 
     //
     // Slow Blitter
@@ -172,6 +218,9 @@ public:
     
     // Optional storage for recording memory locations if BLT_GUARD is enabled
     Buffer<isize> memguard;
+
+    // Optional recorder for all blits
+    BlitTracer tracer;
     
  
     //
@@ -208,6 +257,7 @@ private:
     void _reset(bool hard) override;
     void _run() override;
     void _inspect() const override;
+    isize _memoryFootprint() const override;
 
     template <class T>
     void applyToPersistentItems(T& worker)
@@ -301,6 +351,28 @@ public:
     
     BlitterInfo getInfo() const { return AmigaComponent::getInfo(info); }
 
+    const BlitterStats &getStats() { return stats; }
+    void clearStats() { stats = { }; }
+
+    // Starts or stops recording blits
+    void startTracer();
+    void stopTracer();
+
+    /* Replays a binary blit trace with all accuracy levels. For each level,
+     * the function reports the host time spent per word and checks if Chip
+     * Ram ends up in the same state as with the SlowBlitter. The function
+     * must only be called while the emulator is powered off.
+     */
+    void replayTrace(const string &path, std::ostream& os) throws;
+
+    /* Runs random copy blits twice, with and without the SIMD row kernels,
+     * and compares Chip Ram and the Blitter state after each blit. Registers
+     * and Chip Ram are initialized by a random generator with a fixed seed,
+     * so each run is reproducible. The function must only be called while
+     * the emulator is powered off.
+     */
+    void selfTest(isize count, std::ostream& os) throws;
+
 
     //
     // Accessing
@@ -314,7 +386,7 @@ public:
     // Returns the value of the Blitter Busy Flag
     bool isBusy() const { return bbusy; }
 
-    // Returns the value of the Blitter Zero Flag
+    // Returns the value of the Blitter Zero Flag (undefined in async mode)
     bool isZero() const { return bzero; }
 
     // BLTCON0
@@ -421,6 +493,18 @@ private:
     // Emulates the fill logic circuit
     void doFill(u16 &data, bool &carry) const;
 
+    /* Emulates the fill logic circuit without lookup tables. Bit i of
+     * 'parity' must be the XOR of data bits 0 to i. This allows the parities
+     * of an entire row to be computed in parallel, leaving only the carry to
+     * be propagated from word to word.
+     */
+    static u16 doFillQuick(u16 data, u16 parity, bool &carry, bool exclusive) {
+
+        u16 prefix = carry ? ~parity : parity;
+        if (parity & 0x8000) carry = !carry;
+        return exclusive ? prefix : (prefix ^ data) | data;
+    }
+
     // Emulates the line logic circuit
     void doLine();
 
@@ -460,13 +544,86 @@ private:
     template <bool useA, bool useB, bool useC, bool useD, bool desc>
     void doFastCopyBlit();
 
+    /* Performs a copy blit operation with a fixed minterm. Parameter lf is
+     * either the minterm the kernel is specialized for or -1. In the latter
+     * case, the minterm is evaluated at runtime.
+     */
+    template <bool useA, bool useB, bool useC, bool useD, bool desc, isize lf>
+    void doFastCopyBlit();
+
+    // Processes a single row of a copy blit word by word
+    template <bool useA, bool useB, bool useC, bool useD, bool desc, isize lf>
+    void doFastCopyRow(u32 &apt, u32 &bpt, u32 &cpt, u32 &dpt);
+
+    /* Processes a single row of a copy blit with SIMD operations. The function
+     * returns false if the row cannot be processed this way. This is the case
+     * if the row doesn't reside in Chip Ram in its entirety or if a source
+     * word is overwritten before the Blitter reads it.
+     */
+    template <bool useA, bool useB, bool useC, bool useD, bool desc, isize lf>
+    bool doFastCopyRowSimd(u32 &apt, u32 &bpt, u32 &cpt, u32 &dpt);
+
+    // Returns the lowest address of a row in Chip Ram or -1 if there is none
+    i64 locateRow(u32 ptr, bool desc) const;
+
+    /* Checks if the upcoming copy blit can be processed by the worker thread.
+     * If yes, the function records the affected Chip Ram areas and puts the
+     * last value written by the blit on the data bus. A blit qualifies if it is large, if all rows are processed with
+     * SIMD operations, and if no source word is overwritten by the blit.
+     */
+    bool prepareAsyncBlit();
+
+    // Adds the statistics of the latest fast copy blit to the stats variable
+    void mergeCopyStats();
+
     // Performs a line blit operation via the FastBlitter
     void doFastLineBlit();
 
+    /* Performs a line blit operation with a dedicated Bresenham kernel. The
+     * kernel supports all line blits with channel B disabled. Pixels that
+     * end up in the same destination word are combined in a register and
+     * written to Chip Ram in a single step.
+     */
+    void doFastLineBlitQuick();
+
     // Performs a line blit operation via the FastBlitter (old code)
     void doLegacyFastLineBlit();
 
 
+    //
+    //  Running the Fast Blitter asynchronously
+    //
+
+public:
+
+    // Indicates if the worker thread is processing a blit
+    bool isRunningAsync() const { return asyncBlit; }
+
+    // Waits for the worker thread if a blit is processed asynchronously
+    void finishAsyncBlit() { if (asyncBlit) joinAsyncBlit(); }
+
+    /* Waits for the worker thread if the asynchronous blit affects a Chip Ram
+     * location. The Blitter must be synchronized with all reads from the
+     * destination area and with all writes to the source or destination area.
+     */
+    void willReadChip(u32 addr) {
+        if (asyncBlit && inArea(addr, asyncDst)) joinAsyncBlit();
+    }
+    void willWriteChip(u32 addr) {
+        if (asyncBlit && (inArea(addr, asyncDst) || inArea(addr, asyncSrc))) joinAsyncBlit();
+    }
+
+private:
+
+    bool inArea(u32 addr, const i64 *area) const {
+        auto offset = i64(addr & mem.chipMask);
+        return offset >= area[0] && offset < area[1];
+    }
+
+    // Waits until the worker thread has finished the blit
+    void joinAsyncBlit();
+
+
     //
     //  Executing the Slow Blitter
     //
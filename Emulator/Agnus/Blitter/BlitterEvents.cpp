@@ -20,6 +20,10 @@ Blitter::serviceEvent()
 void
 Blitter::serviceEvent(EventID id)
 {
+    // Measure the host time spent on the blit if blits are recorded
+    bool timed = tracer.isEnabled();
+    if (timed) tracer.resume();
+
     switch (id) {
 
         case BLT_STRT1:
@@ -82,4 +86,6 @@ Blitter::serviceEvent(EventID id)
         default:
             fatalError;
     }
+
+    if (timed) tracer.pause();
 }
@@ -10,6 +10,7 @@
 #include "config.h"
 #include "Agnus.h"
 #include "IOUtils.h"
+#include <algorithm>
 
 void
 Blitter::_dump(Category category, std::ostream& os) const
@@ -19,6 +20,7 @@ Blitter::_dump(Category category, std::ostream& os) const
     if (category == Category::Config) {
         
         os << tab("Accuracy level") << config.accuracy << std::endl;
+        os << tab("Asynchronous blits") << bol(config.async) << std::endl;
     }
     
     if (category == Category::State) {
@@ -77,6 +79,46 @@ Blitter::_dump(Category category, std::ostream& os) const
         os << tab("BLTCMOD") << dec(bltcmod) << std::endl;
         os << tab("BLTDMOD") << dec(bltdmod) << std::endl;
     }
+
+    if (category == Category::Stats) {
+
+        isize blits = 0, specialized = 0;
+        std::vector<std::pair<isize, isize>> minterms;
+
+        for (isize i = 0; i < 256; i++) {
+
+            blits += stats.blits[i];
+            specialized += stats.specialized[i];
+            if (stats.blits[i]) minterms.push_back( { stats.words[i], i } );
+        }
+
+        os << tab("Copy blits") << dec(blits) << std::endl;
+        os << tab("Specialized kernels") << dec(specialized) << std::endl;
+        os << tab("SIMD rows") << dec(stats.simdRows) << std::endl;
+        os << tab("Asynchronous blits") << dec(stats.asyncBlits) << std::endl;
+        os << tab("Worker thread stalls") << dec(stats.asyncStalls) << std::endl;
+
+        if (minterms.empty()) return;
+
+        // Sort the minterms by the number of processed words
+        std::sort(minterms.begin(), minterms.end(), std::greater<>());
+
+        os << std::endl;
+        os << tab("Minterm");
+        os << "     Blits       Words  Specialized" << std::endl;
+
+        for (auto &it : minterms) {
+
+            auto lf = it.second;
+            char name[16], line[80];
+            snprintf(name, sizeof(name), "0x%02lx", long(lf));
+            snprintf(line, sizeof(line), "%10ld  %10ld  %11ld",
+                     long(stats.blits[lf]), long(stats.words[lf]),
+                     long(stats.specialized[lf]));
+
+            os << tab(name) << line << std::endl;
+        }
+    }
 }
 
 void
@@ -22,6 +22,8 @@ Blitter::pokeBLTCON0(u16 value)
 void
 Blitter::setBLTCON0(u16 value)
 {
+    finishAsyncBlit();
+
     if (running) {
         trace(BLT_REG_GUARD, "BLTCON0 written while Blitter is running\n");
     }
@@ -43,6 +45,8 @@ Blitter::pokeBLTCON0L(u16 value)
 void
 Blitter::setBLTCON0L(u16 value)
 {
+    finishAsyncBlit();
+
     if (running) {
         trace(BLT_REG_GUARD, "BLTCON0L written while Blitter is running\n");
     }
@@ -98,6 +102,8 @@ Blitter::pokeBLTCON1(u16 value)
 void
 Blitter::setBLTCON1(u16 value)
 {
+    finishAsyncBlit();
+
     if (running) {
         trace(BLT_REG_GUARD, "BLTCON1 written while Blitter is running\n");
     }
@@ -148,6 +154,8 @@ Blitter::pokeBLTAPTH(u16 value)
 {
     trace(BLTREG_DEBUG, "pokeBLTAPTH(%X)\n", value);
 
+    finishAsyncBlit();
+
     if (running) {
         trace(BLT_REG_GUARD, "BLTAPTH written while Blitter is running\n");
     }
@@ -164,6 +172,8 @@ Blitter::pokeBLTAPTL(u16 value)
 {
     trace(BLTREG_DEBUG, "pokeBLTAPTL(%X)\n", value);
     
+    finishAsyncBlit();
+
     if(running) {
         trace(BLT_REG_GUARD, "BLTAPTL written while Blitter is running\n");
     }
@@ -176,6 +186,8 @@ Blitter::pokeBLTBPTH(u16 value)
 {
     trace(BLTREG_DEBUG, "pokeBLTBPTH(%X)\n", value);
     
+    finishAsyncBlit();
+
     if(running) {
         trace(BLT_REG_GUARD, "BLTBPTH written while Blitter is running\n");
     }
@@ -192,6 +204,8 @@ Blitter::pokeBLTBPTL(u16 value)
 {
     trace(BLTREG_DEBUG, "pokeBLTBPTL(%X)\n", value);
     
+    finishAsyncBlit();
+
     if (running) {
         trace(BLT_REG_GUARD, "BLTBPTL written while Blitter is running\n");
     }
@@ -204,6 +218,8 @@ Blitter::pokeBLTCPTH(u16 value)
 {
     trace(BLTREG_DEBUG, "pokeBLTCPTH(%X)\n", value);
     
+    finishAsyncBlit();
+
     if (running) {
         trace(BLT_REG_GUARD, "BLTCPTH written while Blitter is running\n");
     }
@@ -220,6 +236,8 @@ Blitter::pokeBLTCPTL(u16 value)
 {
     trace(BLTREG_DEBUG, "pokeBLTCPTL(%X)\n", value);
     
+    finishAsyncBlit();
+
     if(running) {
         trace(BLT_REG_GUARD, "BLTCPTL written while Blitter is running\n");
     }
@@ -232,6 +250,8 @@ Blitter::pokeBLTDPTH(u16 value)
 {
     trace(BLTREG_DEBUG, "pokeBLTDPTH(%X)\n", value);
     
+    finishAsyncBlit();
+
     if (running) {
         trace(BLT_REG_GUARD, "BLTDPTH written while Blitter is running\n");
     }
@@ -248,6 +268,8 @@ Blitter::pokeBLTDPTL(u16 value)
 {
     trace(BLTREG_DEBUG, "pokeBLTDPTL(%X)\n", value);
     
+    finishAsyncBlit();
+
     if (running) {
         trace(BLT_REG_GUARD, "BLTDPTL written while Blitter is running\n");
     }
@@ -260,6 +282,8 @@ Blitter::pokeBLTAFWM(u16 value)
 {
     trace(BLTREG_DEBUG, "pokeBLTAFWM(%X)\n", value);
     
+    finishAsyncBlit();
+
     if (running) {
         trace(BLT_REG_GUARD, "BLTAFWM written while Blitter is running\n");
     }
@@ -272,6 +296,8 @@ Blitter::pokeBLTALWM(u16 value)
 {
     trace(BLTREG_DEBUG, "pokeBLTALWM(%X)\n", value);
     
+    finishAsyncBlit();
+
     if (running) {
         trace(BLT_REG_GUARD, "BLTALWM written while Blitter is running\n");
     }
@@ -293,6 +319,8 @@ Blitter::setBLTSIZE(u16 value)
 {
     trace(BLTREG_DEBUG, "setBLTSIZE(%X)\n", value);
     
+    finishAsyncBlit();
+
     if (running) {
         trace(BLT_REG_GUARD, "BLTSIZE written while Blitter is running\n");
     }
@@ -332,6 +360,8 @@ Blitter::pokeBLTSIZV(u16 value)
 void
 Blitter::setBLTSIZV(u16 value)
 {
+    finishAsyncBlit();
+
     if (running) {
         trace(BLT_REG_GUARD, "BLTSIZV written while Blitter is running\n");
     }
@@ -349,6 +379,8 @@ Blitter::pokeBLTSIZH(u16 value)
     // ECS only register
     if (agnus.isOCS()) return;
 
+    finishAsyncBlit();
+
     if (running) {
         trace(BLT_REG_GUARD, "BLTSIZH written while Blitter is running\n");
     }
@@ -372,6 +404,8 @@ Blitter::pokeBLTAMOD(u16 value)
 {
     trace(BLTREG_DEBUG, "pokeBLTAMOD(%X)\n", value);
     
+    finishAsyncBlit();
+
     if (running) {
         trace(BLT_REG_GUARD, "BLTAMOD written while Blitter is running\n");
     }
@@ -383,6 +417,8 @@ Blitter::pokeBLTBMOD(u16 value)
 {
     trace(BLTREG_DEBUG, "pokeBLTBMOD(%X)\n", value);
     
+    finishAsyncBlit();
+
     if (running) {
         trace(BLT_REG_GUARD, "BLTBMOD written while Blitter is running\n");
     }
@@ -395,6 +431,8 @@ Blitter::pokeBLTCMOD(u16 value)
 {
     trace(BLTREG_DEBUG, "pokeBLTCMOD(%X)\n", value);
     
+    finishAsyncBlit();
+
     if (running) {
         trace(BLT_REG_GUARD, "BLTCMOD written while Blitter is running\n");
     }
@@ -407,6 +445,8 @@ Blitter::pokeBLTDMOD(u16 value)
 {
     trace(BLTREG_DEBUG, "pokeBLTDMOD(%X)\n", value);
     
+    finishAsyncBlit();
+
     if (running) {
         trace(BLT_REG_GUARD, "BLTDMOD written while Blitter is running\n");
     }
@@ -419,6 +459,8 @@ Blitter::pokeBLTADAT(u16 value)
 {
     trace(BLTREG_DEBUG, "pokeBLTADAT(%X)\n", value);
     
+    finishAsyncBlit();
+
     if (running) {
         trace(BLT_REG_GUARD, "BLTADAT written while Blitter is running\n");
     }
@@ -431,6 +473,8 @@ Blitter::pokeBLTBDAT(u16 value)
 {
     trace(BLTREG_DEBUG, "pokeBLTBDAT(%X)\n", value);
     
+    finishAsyncBlit();
+
     if (running) {
         trace(BLT_REG_GUARD, "BLTBDAT written while Blitter is running\n");
     }
@@ -451,6 +495,8 @@ Blitter::pokeBLTCDAT(u16 value)
 {
     trace(BLTREG_DEBUG, "pokeBLTCDAT(%X)\n", value);
     
+    finishAsyncBlit();
+
     if (running) {
         trace(BLT_REG_GUARD, "BLTCDAT written while Blitter is running\n");
     }
@@ -54,9 +54,32 @@ constexpr u16 BLTCON1_SING    = 0x0002;
 typedef struct
 {
     isize accuracy;
+    bool async;
 }
 BlitterConfig;
 
+typedef struct
+{
+    // Number of copy blits per minterm
+    isize blits[256];
+
+    // Number of words processed by copy blits per minterm
+    isize words[256];
+
+    // Number of copy blits handled by a specialized FastBlitter kernel
+    isize specialized[256];
+
+    // Number of rows processed with SIMD operations
+    isize simdRows;
+
+    // Number of copy blits processed by the worker thread
+    isize asyncBlits;
+
+    // Number of times the emulator thread had to wait for the worker thread
+    isize asyncStalls;
+}
+BlitterStats;
+
 typedef struct
 {
     u16 bltcon0;
@@ -13,6 +13,22 @@
 #include "Checksum.h"
 #include "Memory.h"
 #include "Paula.h"
+#include "SSEUtils.h"
+#include <algorithm>
+
+/* Evaluates a minterm function that is known at compile time. The function is
+ * applied to single words as well as to SIMD vectors.
+ */
+template <isize lf, class T> static inline T
+applyMinterm(const T &a, const T &b, const T &c)
+{
+    if constexpr (lf == 0x00) return T { };
+    if constexpr (lf == 0xFF) return T(~T { });
+    if constexpr (lf == 0xF0) return a;
+    if constexpr (lf == 0xCA) return T((a & b) | (~a & c));
+    if constexpr (lf == 0xEA) return T((a & b) | c);
+    if constexpr (lf == 0xFC) return T(a | b);
+}
 
 void
 Blitter::initFastBlitter()
@@ -48,7 +64,19 @@ Blitter::beginFastCopyBlit()
 
     // Run the fast copy Blitter
     isize nr = ((bltcon0 >> 7) & 0b11110) | (bltconDESC() ? 1 : 0);
-    (this->*blitfunc[nr])();
+
+    if (prepareAsyncBlit()) {
+
+        // Let the worker thread do the job
+        asyncBlit = true;
+        stats.asyncBlits++;
+        worker.run([this, nr]() { (this->*blitfunc[nr])(); });
+
+    } else {
+
+        (this->*blitfunc[nr])();
+        mergeCopyStats();
+    }
 
     // Terminate immediately
     clearBusyFlag();
@@ -74,105 +102,525 @@ Blitter::beginFastLineBlit()
 template <bool useA, bool useB, bool useC, bool useD, bool desc>
 void Blitter::doFastCopyBlit()
 {
+    constexpr isize channels = useA << 3 | useB << 2 | useC << 1 | useD;
+    auto lf = u8(bltcon0);
+
+    // Run a specialized kernel for the most common minterms
+    if constexpr (channels == 0b0001) {
+
+        if (lf == 0x00) { doFastCopyBlit <useA, useB, useC, useD, desc, 0x00> (); return; }
+        if (lf == 0xFF) { doFastCopyBlit <useA, useB, useC, useD, desc, 0xFF> (); return; }
+    }
+    if constexpr (channels == 0b1001) {
+
+        if (lf == 0xF0) { doFastCopyBlit <useA, useB, useC, useD, desc, 0xF0> (); return; }
+    }
+    if constexpr (channels == 0b1101) {
+
+        if (lf == 0xFC) { doFastCopyBlit <useA, useB, useC, useD, desc, 0xFC> (); return; }
+    }
+    if constexpr (channels == 0b1111) {
+
+        if (lf == 0xEA) { doFastCopyBlit <useA, useB, useC, useD, desc, 0xEA> (); return; }
+    }
+    if constexpr (useD) {
+
+        // Cookie-cut blits are also run with A or B taken from the data registers
+        if (lf == 0xCA) { doFastCopyBlit <useA, useB, useC, useD, desc, 0xCA> (); return; }
+    }
+
+    // Run the generic kernel
+    doFastCopyBlit <useA, useB, useC, useD, desc, -1> ();
+}
+
+template <bool useA, bool useB, bool useC, bool useD, bool desc, isize lf>
+void Blitter::doFastCopyBlit()
+{
+    copyMinterm = lf;
+    copySimdRows = 0;
+
     u32 apt = bltapt;
     u32 bpt = bltbpt;
     u32 cpt = bltcpt;
     u32 dpt = bltdpt;
 
-    bool fill = bltconFE();
-    bool fillCarry;
-
-    int incr = desc ? -2 : 2;
     i32 amod = desc ? -bltamod : bltamod;
     i32 bmod = desc ? -bltbmod : bltbmod;
     i32 cmod = desc ? -bltcmod : bltcmod;
     i32 dmod = desc ? -bltdmod : bltdmod;
 
+    /* Rows are processed with SIMD operations if the row is wide enough. The
+     * heatmap and the checksum computation need to see each access.
+     */
+    bool simd = simdEnabled && bltsizeH >= minSimdWords && !mem.heatmap.isEnabled();
+    if constexpr (BLT_CHECKSUM) simd = false;
+
     aold = 0;
     bold = 0;
 
     for (isize y = 0; y < bltsizeV; y++) {
 
-        // Reset the fill carry bit
-        fillCarry = !!bltconFCI();
+        // Process the row
+        if (simd && doFastCopyRowSimd <useA, useB, useC, useD, desc, lf> (apt, bpt, cpt, dpt)) {
+            copySimdRows++;
+        } else {
+            doFastCopyRow <useA, useB, useC, useD, desc, lf> (apt, bpt, cpt, dpt);
+        }
 
-        // Apply the "first word mask" in the first iteration
-        u16 mask = bltafwm;
+        // Add modulo values
+        if (useA) apt = U32_ADD(apt, amod);
+        if (useB) bpt = U32_ADD(bpt, bmod);
+        if (useC) cpt = U32_ADD(cpt, cmod);
+        if (useD) dpt = U32_ADD(dpt, dmod);
+    }
 
-        for (isize x = 0; x < bltsizeH; x++) {
+    // Write back pointer registers
+    bltapt = apt;
+    bltbpt = bpt;
+    bltcpt = cpt;
+    bltdpt = dpt;
+}
 
-            // Apply the "last word mask" in the last iteration
-            if (x == bltsizeH - 1) mask &= bltalwm;
+template <bool useA, bool useB, bool useC, bool useD, bool desc, isize lf>
+void Blitter::doFastCopyRow(u32 &apt, u32 &bpt, u32 &cpt, u32 &dpt)
+{
+    bool fill = bltconFE();
+    int incr = desc ? -2 : 2;
 
-            // Fetch A
-            if (useA) {
-                anew = mem.peek16 <ACCESSOR_AGNUS> (apt);
-                trace(BLT_DEBUG, "    A = %X <- %X\n", anew, apt);
-                apt = U32_ADD(apt, incr);
-            }
+    // Reset the fill carry bit
+    bool fillCarry = !!bltconFCI();
 
-            // Fetch B
-            if (useB) {
-                bnew = mem.peek16 <ACCESSOR_AGNUS> (bpt);
-                trace(BLT_DEBUG, "    B = %X <- %X\n", bnew, bpt);
-                bpt = U32_ADD(bpt, incr);
-            }
+    // Apply the "first word mask" in the first iteration
+    u16 mask = bltafwm;
 
-            // Fetch C
-            if (useC) {
-                chold = mem.peek16 <ACCESSOR_AGNUS> (cpt);
-                trace(BLT_DEBUG, "    C = %X <- %X\n", chold, cpt);
-                cpt = U32_ADD(cpt, incr);
-            }
-            
-            // Run the barrel shifter on path A (even if channel A is disabled)
-            ahold = barrelShifter(anew & mask, aold, bltconASH(), desc);
-            aold = anew & mask;
-                        
-            // Run the barrel shifter on path B (if channel B is enabled)
-            if (useB) {
-                bhold = barrelShifter(bnew, bold, bltconBSH(), desc);
-                bold = bnew;
-            }
-            
-            // Run the minterm circuit
+    for (isize x = 0; x < bltsizeH; x++) {
+
+        // Apply the "last word mask" in the last iteration
+        if (x == bltsizeH - 1) mask &= bltalwm;
+
+        // Fetch A
+        if (useA) {
+            anew = mem.peek16 <ACCESSOR_AGNUS> (apt);
+            mem.heatmap.read <HEAT_BLITTER> (apt);
+            trace(BLT_DEBUG, "    A = %X <- %X\n", anew, apt);
+            apt = U32_ADD(apt, incr);
+        }
+
+        // Fetch B
+        if (useB) {
+            bnew = mem.peek16 <ACCESSOR_AGNUS> (bpt);
+            mem.heatmap.read <HEAT_BLITTER> (bpt);
+            trace(BLT_DEBUG, "    B = %X <- %X\n", bnew, bpt);
+            bpt = U32_ADD(bpt, incr);
+        }
+
+        // Fetch C
+        if (useC) {
+            chold = mem.peek16 <ACCESSOR_AGNUS> (cpt);
+            mem.heatmap.read <HEAT_BLITTER> (cpt);
+            trace(BLT_DEBUG, "    C = %X <- %X\n", chold, cpt);
+            cpt = U32_ADD(cpt, incr);
+        }
+
+        // Run the barrel shifter on path A (even if channel A is disabled)
+        ahold = barrelShifter(anew & mask, aold, bltconASH(), desc);
+        aold = anew & mask;
+
+        // Run the barrel shifter on path B (if channel B is enabled)
+        if (useB) {
+            bhold = barrelShifter(bnew, bold, bltconBSH(), desc);
+            bold = bnew;
+        }
+
+        // Run the minterm circuit
+        if constexpr (lf >= 0) {
+            dhold = applyMinterm <lf> (ahold, bhold, chold);
+        } else {
             dhold = doMintermLogic(ahold, bhold, chold, bltcon0 & 0xFF);
+        }
 
-            // Run the fill logic circuit
-            if (fill) doFill(dhold, fillCarry);
+        // Run the fill logic circuit
+        if (fill) doFill(dhold, fillCarry);
 
-            // Update the zero flag
-            if (dhold) bzero = false;
+        // Update the zero flag
+        if (dhold) bzero = false;
 
-            // Write D
-            if (useD) {
-                mem.poke16 <ACCESSOR_AGNUS> (dpt, dhold);
+        // Write D
+        if (useD) {
+            mem.poke16 <ACCESSOR_AGNUS> (dpt, dhold);
+            mem.heatmap.write <HEAT_BLITTER> (dpt);
 
-                if (BLT_CHECKSUM) {
-                    check1 = util::fnvIt32(check1, dhold);
-                    check2 = util::fnvIt32(check2, dpt & agnus.ptrMask);
-                }
-                trace(BLT_DEBUG, "    D = %X -> %X\n", dhold, dpt);
-                
-                dpt = U32_ADD(dpt, incr);
+            if (BLT_CHECKSUM) {
+                check1 = util::fnvIt32(check1, dhold);
+                check2 = util::fnvIt32(check2, dpt & agnus.ptrMask);
             }
+            trace(BLT_DEBUG, "    D = %X -> %X\n", dhold, dpt);
 
-            // Clear the word mask
-            mask = 0xFFFF;
+            dpt = U32_ADD(dpt, incr);
         }
 
-        // Add modulo values
-        if (useA) apt = U32_ADD(apt, amod);
-        if (useB) bpt = U32_ADD(bpt, bmod);
-        if (useC) cpt = U32_ADD(cpt, cmod);
-        if (useD) dpt = U32_ADD(dpt, dmod);
+        // Clear the word mask
+        mask = 0xFFFF;
     }
+}
 
-    // Write back pointer registers
-    bltapt = apt;
-    bltbpt = bpt;
-    bltcpt = cpt;
-    bltdpt = dpt;
+template <bool useA, bool useB, bool useC, bool useD, bool desc, isize lf>
+bool Blitter::doFastCopyRowSimd(u32 &apt, u32 &bpt, u32 &cpt, u32 &dpt)
+{
+    using namespace util;
+
+    isize w = bltsizeH;
+    i64 bytes = 2 * w;
+    i64 a = 0, b = 0, c = 0, d = 0;
+
+    if (w < minSimdWords) return false;
+
+    // Make sure that all rows reside in Chip Ram
+    if (useA && (a = locateRow(apt, desc)) < 0) return false;
+    if (useB && (b = locateRow(bpt, desc)) < 0) return false;
+    if (useC && (c = locateRow(cpt, desc)) < 0) return false;
+    if (useD && (d = locateRow(dpt, desc)) < 0) return false;
+
+    /* The row is processed in three steps. At first, all source words are
+     * read. Afterwards, all destination words are computed and written back.
+     * This yields the same result as processing the row word by word, unless
+     * a source word is overwritten by a preceding word of the same row.
+     */
+    if (useD) {
+
+        auto overlaps = [&](i64 s) {
+
+            auto delta = (s & mem.chipMask) - (d & mem.chipMask);
+            if (!desc) delta = -delta;
+            return delta > 0 && delta < bytes;
+        };
+        if ((useA && overlaps(a)) || (useB && overlaps(b)) || (useC && overlaps(c))) {
+            return false;
+        }
+    }
+
+    // Reads a row from Chip Ram in processing order
+    auto fetch = [&](u16 *dst, i64 addr) {
+
+        auto src = mem.chip + (addr & mem.chipMask);
+        isize x = 0;
+
+        if (desc) {
+            for (; x < w; x++) dst[x] = R16BE(src + bytes - 2 - 2 * x);
+        } else {
+            for (; x + 8 <= w; x += 8) storeU16x8(dst + x, bigEndianU16x8(loadU16x8(src + 2 * x)));
+            for (; x < w; x++) dst[x] = R16BE(src + 2 * x);
+        }
+    };
+
+    // Writes a row into Chip Ram in processing order
+    auto store = [&](const u16 *src, i64 addr) {
+
+        auto dst = mem.chip + (addr & mem.chipMask);
+        isize x = 0;
+
+        if (desc) {
+            for (; x < w; x++) W16BE(dst + bytes - 2 - 2 * x, src[x]);
+        } else {
+            for (; x + 8 <= w; x += 8) storeU16x8(dst + 2 * x, bigEndianU16x8(loadU16x8(src + x)));
+            for (; x < w; x++) W16BE(dst + 2 * x, src[x]);
+        }
+    };
+
+    // Runs the barrel shifter
+    auto shift = [&](const u16x8 &cur, const u16x8 &prev, u16 sh) {
+
+        if (sh == 0) return cur;
+        if (desc) return (cur << sh) | (prev >> (16 - sh));
+        return (prev << (16 - sh)) | (cur >> sh);
+    };
+
+    /* Row buffers. Index 0 of A and B holds the last word of the previous
+     * row. All buffers are padded to cover an integral number of vectors.
+     */
+    u16 abuf[maxRowWords + 9], bbuf[maxRowWords + 9], cbuf[maxRowWords + 8], dbuf[maxRowWords + 8];
+    u16 *ar = abuf + 1, *br = bbuf + 1;
+    isize padded = (w + 7) & ~7;
+
+    // Fetch A and apply the first and last word masks
+    abuf[0] = aold;
+    if (useA) {
+        fetch(ar, a);
+        anew = ar[w - 1];
+    } else {
+        for (isize x = 0; x < w; x++) ar[x] = anew;
+    }
+    ar[0] &= bltafwm;
+    ar[w - 1] &= bltalwm;
+    for (isize x = w; x < padded; x++) ar[x] = 0;
+
+    // Fetch B
+    if (useB) {
+        bbuf[0] = bold;
+        fetch(br, b);
+        for (isize x = w; x < padded; x++) br[x] = 0;
+    }
+
+    // Fetch C
+    if (useC) {
+        fetch(cbuf, c);
+        for (isize x = w; x < padded; x++) cbuf[x] = 0;
+    }
+
+    // Prepare the minterm masks
+    u8 minterm = bltcon0 & 0xFF;
+    u16x8 m[8];
+    for (isize i = 0; i < 8; i++) m[i] = splatU16x8(minterm & (1 << i) ? 0xFFFF : 0);
+
+    // Compute D
+    auto ash = bltconASH();
+    auto bsh = bltconBSH();
+    u16x8 bv = splatU16x8(bhold);
+    u16x8 cv = splatU16x8(chold);
+    u16x8 any = { };
+
+    for (isize x = 0; x < padded; x += 8) {
+
+        u16x8 av = shift(loadU16x8(ar + x), loadU16x8(abuf + x), ash);
+        if (useB) bv = shift(loadU16x8(br + x), loadU16x8(bbuf + x), bsh);
+        if (useC) cv = loadU16x8(cbuf + x);
+
+        // Evaluate the minterm function by selecting the matching minterm bits
+        auto sel = [](const u16x8 &s, const u16x8 &t, const u16x8 &f) {
+            return (s & t) | (~s & f);
+        };
+        u16x8 d;
+        if constexpr (lf >= 0) {
+            d = applyMinterm <lf> (av, bv, cv);
+        } else {
+            d = sel(av,
+                    sel(bv, sel(cv, m[7], m[6]), sel(cv, m[5], m[4])),
+                    sel(bv, sel(cv, m[3], m[2]), sel(cv, m[1], m[0])));
+        }
+
+        storeU16x8(dbuf + x, d);
+        if (x + 8 <= w) any |= d;
+    }
+
+    // Check if a word of the row is nonzero (excluding the padding words)
+    u16 nonzero = orU16x8(any);
+    for (isize x = w & ~7; x < w; x++) nonzero |= dbuf[x];
+
+    if constexpr (BLT_DEBUG) {
+
+        for (isize i = 0; i < w; i++) {
+
+            auto ah = barrelShifter(ar[i], abuf[i], ash, desc);
+            auto bh = useB ? barrelShifter(br[i], bbuf[i], bsh, desc) : bhold;
+            auto ch = useC ? cbuf[i] : chold;
+
+            if (dbuf[i] != doMintermLogic(ah, bh, ch, minterm)) fatal("Blitter SIMD error\n");
+        }
+    }
+
+    // Run the fill logic circuit
+    if (bltconFE()) {
+
+        // Compute the prefix parities of all words
+        u16 pbuf[maxRowWords + 8];
+        for (isize x = 0; x < padded; x += 8) {
+
+            u16x8 p = loadU16x8(dbuf + x);
+            p ^= p << 1;
+            p ^= p << 2;
+            p ^= p << 4;
+            p ^= p << 8;
+            storeU16x8(pbuf + x, p);
+        }
+
+        // Propagate the fill carry through the row
+        bool carry = bltconFCI();
+        bool exclusive = bltconEFE();
+        nonzero = 0;
+
+        for (isize x = 0; x < w; x++) {
+
+            u16 data = dbuf[x];
+            bool carryIn = carry;
+
+            dbuf[x] = doFillQuick(data, pbuf[x], carry, exclusive);
+            nonzero |= dbuf[x];
+
+            if constexpr (BLT_DEBUG) {
+
+                doFill(data, carryIn);
+                if (data != dbuf[x] || carryIn != carry) fatal("Blitter SIMD fill error\n");
+            }
+        }
+    }
+
+    // Write D
+    if (useD) {
+
+        store(dbuf, d);
+    }
+
+    // Update the pipeline registers as if the last word has been processed
+    ahold = barrelShifter(ar[w - 1], abuf[w - 1], ash, desc);
+    aold = ar[w - 1];
+    if (useB) {
+        bhold = barrelShifter(br[w - 1], bbuf[w - 1], bsh, desc);
+        bnew = bold = br[w - 1];
+    }
+    if (useC) chold = cbuf[w - 1];
+    dhold = dbuf[w - 1];
+    if (nonzero) bzero = false;
+
+    // Update the data bus with the value of the last access (unless done already)
+    if (!asyncBlit) {
+
+        if (useD) mem.dataBus = dhold;
+        else if (useC) mem.dataBus = chold;
+        else if (useB) mem.dataBus = bnew;
+        else if (useA) mem.dataBus = anew;
+    }
+
+    // Advance the pointers
+    if (useA) apt = U32_ADD(apt, desc ? -bytes : bytes);
+    if (useB) bpt = U32_ADD(bpt, desc ? -bytes : bytes);
+    if (useC) cpt = U32_ADD(cpt, desc ? -bytes : bytes);
+    if (useD) dpt = U32_ADD(dpt, desc ? -bytes : bytes);
+
+    return true;
+}
+
+i64
+Blitter::locateRow(u32 ptr, bool desc) const
+{
+    i64 bytes = 2 * bltsizeH;
+
+    if (ptr & 1) return -1;
+
+    // Compute the address range covered by the row
+    i64 lo = desc ? i64(ptr & agnus.ptrMask) - bytes + 2 : i64(ptr & agnus.ptrMask);
+    i64 hi = lo + bytes - 1;
+
+    // The row must not wrap around
+    if (lo < 0 || hi > agnus.ptrMask) return -1;
+    if ((lo & ~i64(mem.chipMask)) != (hi & ~i64(mem.chipMask))) return -1;
+
+    // All banks must be mapped to Chip Ram
+    for (i64 bank = lo >> 16; bank <= hi >> 16; bank++) {
+        if (mem.agnusMemSrc[bank] != MEM_CHIP) return -1;
+    }
+
+    return lo;
+}
+
+bool
+Blitter::prepareAsyncBlit()
+{
+    bool useA = bltconUSEA();
+    bool useB = bltconUSEB();
+    bool useC = bltconUSEC();
+    bool desc = bltconDESC();
+
+    isize w = bltsizeH;
+    i64 bytes = 2 * w;
+    i64 a = 0, b = 0, c = 0, d = 0;
+
+    if (!config.async || !bltconUSED() || bltconFE()) return false;
+    if (w < minSimdWords || w * bltsizeV < minAsyncWords) return false;
+    if (mem.heatmap.isEnabled() || BLT_CHECKSUM) return false;
+
+    u32 apt = bltapt;
+    u32 bpt = bltbpt;
+    u32 cpt = bltcpt;
+    u32 dpt = bltdpt;
+
+    i64 step = desc ? -bytes : bytes;
+    i32 amod = desc ? -bltamod : bltamod;
+    i32 bmod = desc ? -bltbmod : bltbmod;
+    i32 cmod = desc ? -bltcmod : bltcmod;
+    i32 dmod = desc ? -bltdmod : bltdmod;
+
+    i64 src[2] = { mem.chipMask + 1, 0 };
+    i64 dst[2] = { mem.chipMask + 1, 0 };
+
+    auto extend = [&](i64 *area, i64 row) {
+
+        area[0] = std::min(area[0], row & mem.chipMask);
+        area[1] = std::max(area[1], (row & mem.chipMask) + bytes);
+    };
+
+    // Make sure that all rows reside in Chip Ram and determine the areas
+    for (isize y = 0; y < bltsizeV; y++) {
+
+        if (useA) {
+            if ((a = locateRow(apt, desc)) < 0) return false;
+            extend(src, a);
+            apt = U32_ADD3(apt, step, amod);
+        }
+        if (useB) {
+            if ((b = locateRow(bpt, desc)) < 0) return false;
+            extend(src, b);
+            bpt = U32_ADD3(bpt, step, bmod);
+        }
+        if (useC) {
+            if ((c = locateRow(cpt, desc)) < 0) return false;
+            extend(src, c);
+            cpt = U32_ADD3(cpt, step, cmod);
+        }
+        if ((d = locateRow(dpt, desc)) < 0) return false;
+        extend(dst, d);
+        dpt = U32_ADD3(dpt, step, dmod);
+    }
+
+    // The blit must not overwrite any of its source words
+    if (src[0] < dst[1] && dst[0] < src[1]) return false;
+
+    asyncSrc[0] = src[0]; asyncSrc[1] = src[1];
+    asyncDst[0] = dst[0]; asyncDst[1] = dst[1];
+
+    /* Compute the last word written by the blit. As the source words remain
+     * untouched, it only depends on the last two words of the last row.
+     */
+    auto fetch = [&](i64 row, isize x) {
+
+        auto addr = desc ? row + bytes - 2 - 2 * x : row + 2 * x;
+        return R16BE(mem.chip + (addr & mem.chipMask));
+    };
+
+    u16 a1 = useA ? fetch(a, w - 1) : anew;
+    u16 a0 = useA ? fetch(a, w - 2) : anew;
+    u16 ah = barrelShifter(a1 & bltalwm, a0, bltconASH(), desc);
+    u16 bh = useB ? barrelShifter(fetch(b, w - 1), fetch(b, w - 2), bltconBSH(), desc) : bhold;
+    u16 ch = useC ? fetch(c, w - 1) : chold;
+
+    asyncData = doMintermLogic(ah, bh, ch, u8(bltcon0));
+    mem.dataBus = asyncData;
+
+    return true;
+}
+
+void
+Blitter::joinAsyncBlit()
+{
+    assert(asyncBlit);
+
+    if (worker.wait()) stats.asyncStalls++;
+    asyncBlit = false;
+    mergeCopyStats();
+
+    if constexpr (BLT_DEBUG) {
+
+        if (dhold != asyncData) fatal("Blitter async error\n");
+    }
+}
+
+void
+Blitter::mergeCopyStats()
+{
+    if (copyMinterm >= 0) stats.specialized[copyMinterm]++;
+    stats.simdRows += copySimdRows;
+
+    copyMinterm = -1;
+    copySimdRows = 0;
 }
 
 void
@@ -255,18 +703,26 @@ Blitter::doFastLineBlit()
         doLegacyFastLineBlit();
         return;
     }
+
+    // Run the Bresenham kernel unless each memory access needs to be seen
+    if (!useB && !mem.heatmap.isEnabled() && !BLT_CHECKSUM) {
+        doFastLineBlitQuick();
+        return;
+    }
                                     
     for (isize i = 0; i < bltsizeV; i++) {
         
         // Fetch B
         if (useB) {
             bnew = mem.peek16 <ACCESSOR_AGNUS> (bltbpt);
+            mem.heatmap.read <HEAT_BLITTER> (bltbpt);
             U32_INC(bltbpt, bltbmod);
         }
         
         // Fetch C
         if (useC) {
             chold = mem.peek16 <ACCESSOR_AGNUS> (bltcpt);
+            mem.heatmap.read <HEAT_BLITTER> (bltcpt);
         }
         
         // Run the barrel shifters
@@ -289,6 +745,7 @@ Blitter::doFastLineBlit()
         if (writeEnable) {
                         
             mem.poke16 <ACCESSOR_AGNUS> (bltdpt, dhold);
+            mem.heatmap.write <HEAT_BLITTER> (bltdpt);
             
             if (BLT_CHECKSUM) {
                 check1 = util::fnvIt32(check1, dhold);
@@ -305,6 +762,165 @@ Blitter::doFastLineBlit()
     REPLACE_BIT(bltcon1, 6, sign);
 }
 
+void
+Blitter::doFastLineBlitQuick()
+{
+    bool useA = bltcon0 & BLTCON0_USEA;
+    bool useC = bltcon0 & BLTCON0_USEC;
+    bool sing = bltcon1 & BLTCON1_SING;
+    bool sign = bltcon1 & BLTCON1_SIGN;
+    bool sud = bltcon1 & BLTCON1_SUD;
+    bool sul = bltcon1 & BLTCON1_SUL;
+    bool aul = bltcon1 & BLTCON1_AUL;
+    bool firstPixel = true;
+    auto ash = bltconASH();
+    auto bsh = bltconBSH();
+    u16 amask = anew & bltafwm;
+
+    /* Channel B is disabled. Hence, the B input of the minterm circuit is
+     * either all zeroes or all ones. For each of the two cases, the minterm
+     * function reduces to a function of A and C which is described by four
+     * masks, one for each combination of an A bit and a C bit.
+     */
+    u16 lf[2][4];
+    for (isize b = 0; b < 2; b++) {
+        for (isize ac = 0; ac < 4; ac++) {
+
+            auto bit = (ac & 2) << 1 | b << 1 | (ac & 1);
+            lf[b][ac] = (bltcon0 >> bit) & 1 ? 0xFFFF : 0;
+        }
+    }
+
+    /* All Chip Ram accesses are served by a single register which caches the
+     * latest destination word. It is written back as soon as the line leaves
+     * the word. Other memory types are accessed directly.
+     */
+    bool pending = false;
+    u32 pendingAddr = 0;
+    u16 pendingValue = 0;
+    u16 bus = mem.dataBus;
+
+    auto isChip = [&](u32 addr) {
+        return mem.agnusMemSrc[addr >> 16] == MEM_CHIP;
+    };
+
+    auto flush = [&]() {
+        if (pending) {
+            W16BE(mem.chip + (pendingAddr & mem.chipMask), pendingValue);
+            pending = false;
+        }
+    };
+
+    auto read = [&](u32 addr) {
+
+        addr &= agnus.ptrMask;
+
+        if (isChip(addr)) {
+
+            // Check if the word maps to the same Chip Ram cell as the cache
+            if (pending && ((addr ^ pendingAddr) & mem.chipMask) == 0) {
+                bus = pendingValue;
+            } else {
+                bus = R16BE(mem.chip + (addr & mem.chipMask));
+            }
+            return bus;
+        }
+
+        flush();
+        mem.dataBus = bus;
+        auto result = mem.peek16 <ACCESSOR_AGNUS> (addr);
+        bus = mem.dataBus;
+        return result;
+    };
+
+    auto write = [&](u32 addr, u16 value) {
+
+        addr &= agnus.ptrMask;
+
+        if (isChip(addr)) {
+
+            if (!pending || addr != pendingAddr) {
+
+                flush();
+                pending = true;
+                pendingAddr = addr;
+            }
+            pendingValue = value;
+
+            bus = value;
+
+        } else {
+
+            flush();
+            mem.dataBus = bus;
+            mem.poke16 <ACCESSOR_AGNUS> (addr, value);
+            bus = mem.dataBus;
+        }
+    };
+
+    // Moves the line by a single pixel horizontally or vertically
+    auto stepX = [&](bool left) {
+
+        if (left) {
+            if (ash-- == 0) { ash = 15; U32_INC(bltcpt, -2); }
+        } else {
+            if (++ash == 16) { ash = 0; U32_INC(bltcpt, 2); }
+        }
+    };
+    auto stepY = [&](bool up) {
+
+        U32_INC(bltcpt, up ? -bltcmod : bltcmod);
+        firstPixel = true;
+    };
+
+    for (isize i = 0; i < bltsizeV; i++) {
+
+        // Fetch C
+        if (useC) chold = read(bltcpt);
+
+        // Run the barrel shifters
+        ahold = u16(amask >> ash);
+        bhold = u16(HI_W_LO_W(bnew, bnew) >> bsh);
+        if (bsh-- == 0) bsh = 15;
+
+        // Run the minterm circuit
+        auto m = lf[bhold & 1];
+        dhold = u16((ahold & chold & m[3]) | (ahold & ~chold & m[2]) |
+                    (~ahold & chold & m[1]) | (~ahold & ~chold & m[0]));
+
+        if constexpr (BLT_DEBUG) {
+
+            auto expected = doMintermLogic(ahold, (bhold & 1) ? 0xFFFF : 0, chold, bltcon0 & 0xFF);
+            if (dhold != expected) fatal("Blitter line kernel error\n");
+        }
+
+        bool writeEnable = (!sing || firstPixel) && useC;
+        firstPixel = false;
+
+        // Run the line logic circuit
+        if (!sign) { if (sud) stepY(sul); else stepX(sul); }
+        if (sud) stepX(aul); else stepY(aul);
+
+        if (useA) U32_INC(bltapt, sign ? bltbmod : bltamod);
+        sign = (i16)bltapt < 0;
+
+        // Update the zero flag
+        if (dhold) bzero = false;
+
+        // Write D
+        if (writeEnable) write(bltdpt, dhold);
+
+        bltdpt = bltcpt;
+    }
+
+    // Write back local values
+    flush();
+    mem.dataBus = bus;
+    setASH(ash);
+    setBSH(bsh);
+    REPLACE_BIT(bltcon1, 6, sign);
+}
+
 /* Below is the old LineBlitter code which had been adapted from WinFellow.
  * The code can be deleted once the new LineBlitter code has proven to be
  * stable.
@@ -378,6 +994,7 @@ Blitter::doLegacyFastLineBlit()
         // Read C-data from memory if the C-channel is enabled
         if (c_enabled) {
             bltcdat_local = mem.peek16 <ACCESSOR_AGNUS> (bltcpt_local);
+            mem.heatmap.read <HEAT_BLITTER> (bltcpt_local);
         }
         
         // Calculate data for the A-channel
@@ -403,6 +1020,7 @@ Blitter::doLegacyFastLineBlit()
         // Save result to D-channel, same as the C ptr after first pixel.
         if (c_enabled) { // C-channel must be enabled
             mem.poke16 <ACCESSOR_AGNUS> (bltdpt_local, bltddat_local);
+            mem.heatmap.write <HEAT_BLITTER> (bltdpt_local);
 
             if (BLT_CHECKSUM) {
                 check1 = util::fnvIt32(check1, bltddat_local);
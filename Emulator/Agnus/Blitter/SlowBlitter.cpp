@@ -794,7 +794,7 @@ Blitter::initSlowBlitter()
                     &Blitter::exec <FETCH_C | HOLD_B>,
                     &Blitter::exec <WRITE_D | REPEAT>,
 
-                    &Blitter::exec <HOLD_D>,
+                    &Blitter::exec <FILL | HOLD_D>,
                     &Blitter::exec <WRITE_D | BLTDONE>
                 }
             },
@@ -814,7 +814,7 @@ Blitter::initSlowBlitter()
                     &Blitter::fakeExec <FETCH_C | HOLD_B>,
                     &Blitter::fakeExec <WRITE_D | REPEAT>,
 
-                    &Blitter::fakeExec <HOLD_D>,
+                    &Blitter::fakeExec <FILL | HOLD_D>,
                     &Blitter::fakeExec <WRITE_D | BLTDONE>
                 }
             }
@@ -958,6 +958,7 @@ Blitter::beginFakeCopyBlit()
     // Run the fast Blitter
     int nr = ((bltcon0 >> 7) & 0b11110) | !!bltconDESC();
     (this->*blitfunc[nr])();
+    mergeCopyStats();
 
     // Prepare the slow Blitter
     resetXCounter();
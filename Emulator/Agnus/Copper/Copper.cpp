@@ -27,6 +27,21 @@ void
 Copper::_reset(bool hard)
 {
     RESET_SNAPSHOT_ITEMS(hard)
+
+    clearCache();
+}
+
+void
+Copper::_didLoad()
+{
+    // The legality checks in the cache depend on the Agnus revision
+    clearCache();
+}
+
+isize
+Copper::_memoryFootprint() const
+{
+    return isize(cache.capacity() * sizeof(CopperRecord));
 }
 
 void
@@ -57,6 +72,46 @@ Copper::switchToCopperList(isize nr)
     agnus.scheduleRel <SLOT_COP> (0, COP_REQ_DMA);
 }
 
+const CopperRecord &
+Copper::decode(CopperRecord &rec)
+{
+    auto &generation = pageGeneration[(coppc0 >> 12) & 511];
+
+    cacheMisses++;
+
+    // If the record holds other words, the Copper list has been modified
+    if (rec.addr == coppc0 && rec.generation == generation) generation++;
+
+    rec.addr = coppc0;
+    rec.generation = generation;
+    rec.cop1ins = cop1ins;
+    rec.cop2ins = cop2ins;
+    rec.reg = cop1ins & 0x1FE;
+
+    if (isMoveCmd()) {
+
+        rec.op =
+        rec.reg == 0x88 ? CopperRecord::Op::Jump1 :
+        rec.reg == 0x8A ? CopperRecord::Op::Jump2 : CopperRecord::Op::Move;
+
+    } else {
+
+        rec.op = isWaitCmd() ? CopperRecord::Op::Wait : CopperRecord::Op::Skip;
+    }
+
+    // Run the legality check for both values of the CDANG bit
+    rec.illegal[0] = isIllegalAddress(rec.reg, false);
+    rec.illegal[1] = isIllegalAddress(rec.reg, true);
+
+    return rec;
+}
+
+void
+Copper::clearCache()
+{
+    for (auto &rec : cache) rec.addr = 1;
+}
+
 bool
 Copper::findMatchOld(Beam &match) const
 {
@@ -103,73 +158,74 @@ Copper::findMatchOld(Beam &match) const
 bool
 Copper::findMatch(Beam &match) const
 {
-    // Start searching at the current beam position
-    u32 beam = (u32)(agnus.pos.v << 8 | agnus.pos.h);
-
     // Get the comparison position and the comparison mask
     u32 comp = getVPHP();
     u32 mask = getVMHM();
 
-    // Iterate through all lines starting from the current position
+    // Split both into their vertical components
+    u32 vcomp = HI_BYTE(comp & mask);
+    u32 vmask = HI_BYTE(mask);
+
     isize numLines = agnus.pos.vCnt();
-    while ((isize)(beam >> 8) < numLines) {
 
-        // Check if the vertical components are equal
-        if ((beam & mask & ~0xFF) == (comp & mask & ~0xFF)) {
+    // Check the current line, starting at the current horizontal position
+    u32 vpos = u32(agnus.pos.v & 0xFF) & vmask;
 
-            // Try to match the horizontal coordinate as well
-            if (findHorizontalMatch(beam, comp, mask)) {
+    if (vpos > vcomp) {
 
-                // Success
-                match.v = beam >> 8;
-                match.h = beam & 0xFF;
-                return true;
-            }
-        }
+        match.v = agnus.pos.v;
+        match.h = agnus.pos.h;
+        return true;
+    }
+    if (vpos == vcomp) {
 
-        // Check if the vertical beam position is greater
-        else if ((beam & mask & ~0xFF) > (comp & mask & ~0xFF)) {
+        u32 beam = (u32)(agnus.pos.v << 8 | agnus.pos.h);
+        if (findHorizontalMatch(beam, comp, mask)) {
 
-            // Success
             match.v = beam >> 8;
             match.h = beam & 0xFF;
             return true;
         }
+    }
 
-        // Jump to the beginning of the next line
-        beam = (beam & ~0xFF) + 0x100;
+    /* All other lines are entered at position 0. Hence, the horizontal
+     * trigger position is the same in all lines with a matching vertical
+     * component. If there is none, we need a line with a greater one.
+     */
+    u32 hmatch = 0;
+    bool hit = findHorizontalMatch(hmatch, comp, mask);
+
+    if constexpr (COP_DEBUG) {
+
+        [[maybe_unused]] u32 ref = 0;
+        assert(hit == findHorizontalMatchOld(ref, comp, mask));
+        assert(!hit || ref == hmatch);
     }
 
-    return false;
-}
+    // Search the remaining lines in chunks with a non-wrapping 8-bit counter
+    for (isize line = agnus.pos.v + 1; line < numLines; ) {
 
-bool
-Copper::findHorizontalMatchOld(u32 &match, u32 comp, u32 mask) const
-{
-    // The maximum horizontal trigger positon is $E1 in PAL machines
-    const u32 maxhpos = 0xE1;
-    
-    // Iterate through all horizontal positions
-    for (u32 beam = match; (beam & 0xFF) < maxhpos; beam++) {
+        isize end = std::min(numLines, (line & ~0xFF) + 0x100);
+        isize next = nextMatch(u32(line & 0xFF), hit ? vcomp : vcomp + 1, vmask);
 
-        // Check if the comparator triggers at this position
-        if ((beam & mask) >= (comp & mask)) {
+        if (next >= 0 && line + next - (line & 0xFF) < end) {
 
-            // Success
-            match = beam;
+            match.v = line + next - (line & 0xFF);
+            match.h = (u32(next) & vmask) == vcomp ? hmatch & 0xFF : 0;
             return true;
         }
+        line = end;
     }
 
     return false;
 }
 
 bool
-Copper::findHorizontalMatch(u32 &match, u32 comp, u32 mask) const
+Copper::findHorizontalMatchOld(u32 &match, u32 comp, u32 mask) const
 {
     u32 v = match & 0x1FF00;
     u32 h = match & 0x000FF;
-        
+
     // Iterate through all horizontal positions execept the last three
     for (auto i = h + 2; i <= 0xE1; i++, h++) {
 
@@ -180,7 +236,7 @@ Copper::findHorizontalMatch(u32 &match, u32 comp, u32 mask) const
             return true;
         }
     }
-    
+
     // Iterate through the last three cycles with a wrapped over counter
     for (auto i = 0; i <= 2; i++, h++) {
 
@@ -195,6 +251,213 @@ Copper::findHorizontalMatch(u32 &match, u32 comp, u32 mask) const
     return false;
 }
 
+bool
+Copper::findHorizontalMatch(u32 &match, u32 comp, u32 mask) const
+{
+    u32 v = match & 0x1FF00;
+    u32 h = match & 0x000FF;
+
+    // The vertical components are equal and can be ignored
+    u32 hcomp = comp & mask & 0xFF;
+    u32 hmask = mask & 0xFF;
+
+    // Check all horizontal positions execept the last three
+    if (h + 2 <= 0xE1) {
+
+        if (auto i = nextMatch(h + 2, hcomp, hmask); i >= 0 && i <= 0xE1) {
+
+            match = v | u32(i - 2);
+            return true;
+        }
+        h = 0xE0;
+    }
+
+    // Check the last three cycles with a wrapped over counter
+    if (auto i = nextMatch(0, hcomp, hmask); i >= 0 && i <= 2) {
+
+        match = v | (h + u32(i));
+        return true;
+    }
+
+    return false;
+}
+
+isize
+Copper::nextMatch(u32 start, u32 comp, u32 mask)
+{
+    // Check if the start value matches already
+    if ((start & mask) >= comp) return start;
+
+    /* Any larger value agrees with 'start' in all bits above some bit k which
+     * is 0 in 'start' and 1 in the larger value. Candidates with a smaller k
+     * are smaller. Hence, we check k = 0, 1, 2, ... and take the first one
+     * for which the lower bits can be completed to a match.
+     */
+    for (isize k = 0; k < 9; k++) {
+
+        u32 bit = 1 << k;
+        if (start & bit) continue;
+
+        // Smallest candidate with bit k set
+        u32 prefix = (start & ~(2 * bit - 1)) | bit;
+
+        // Compare the masked upper bits
+        u32 upper = prefix & mask;
+        u32 upperComp = comp & ~(bit - 1);
+
+        if (upper > upperComp) return prefix;
+        if (upper < upperComp) continue;
+
+        /* Find the smallest submask of the lower mask bits which is >= comp.
+         * The increment trick below computes the smallest submask greater
+         * than x, provided that x has no bits outside the mask. Hence, all
+         * bits below the highest stray bit of x are set first, which does
+         * not change the set of submasks greater than x.
+         */
+        u32 lowerMask = mask & (bit - 1);
+        u32 lowerComp = comp & (bit - 1);
+        u32 lower = 0;
+
+        if (lowerComp) {
+
+            u32 x = lowerComp - 1;
+            if (u32 stray = x & ~lowerMask) x |= 2 * std::bit_floor(stray) - 1;
+            lower = ((x | ~lowerMask) + 1) & lowerMask;
+        }
+
+        if (lower >= lowerComp) return prefix | lower;
+    }
+
+    return -1;
+}
+
+void
+Copper::selfTest(std::ostream& os)
+{
+    using namespace util;
+
+    if (!isPoweredOff()) throw VAError(ERROR_POWERED_ON);
+
+    isize failures[3] = { };
+    i64 cases[3] = { };
+
+    /* nextMatch: Check all 9-bit start values, all 8-bit masks, and all
+     * comparison values up to 256 (findMatch() passes vcomp + 1). The
+     * reference is computed backwards, starting with the largest value.
+     */
+    for (u32 mask = 0; mask < 0x100; mask++) {
+
+        for (u32 comp = 0; comp <= 0x100; comp++) {
+
+            isize expected = -1;
+
+            for (isize start = 0x1FF; start >= 0; start--) {
+
+                if ((u32(start) & mask) >= comp) expected = start;
+                if (nextMatch(u32(start), comp, mask) != expected) failures[0]++;
+                cases[0]++;
+            }
+        }
+    }
+
+    /* findHorizontalMatch: Check all horizontal positions and all values of
+     * the lower bytes of the comparison value and the mask. The vertical
+     * components are zero and hence equal.
+     */
+    for (u32 h = 0; h < HPOS_CNT; h++) {
+
+        for (u32 comp = 0; comp < 0x100; comp++) {
+
+            for (u32 mask = 0; mask < 0x100; mask++) {
+
+                u32 beam1 = h, beam2 = h;
+                auto hit1 = findHorizontalMatch(beam1, comp, 0xFF00 | mask);
+                auto hit2 = findHorizontalMatchOld(beam2, comp, 0xFF00 | mask);
+
+                if (hit1 != hit2 || (hit1 && beam1 != beam2)) failures[1]++;
+                cases[1]++;
+            }
+        }
+    }
+
+    /* findMatch: Check all frame types, all lines, all vertical comparison
+     * values, and all vertical masks. The horizontal position runs through
+     * all values in turn. findMatch() depends on the horizontal components
+     * through findHorizontalMatch() only, which is checked exhaustively
+     * above. Hence, the horizontal components are taken from a set which
+     * covers an immediate match, no match, matches early and late in the
+     * line, a match in the wrapped area, and partial masks. In addition,
+     * a running counter sweeps through all pairs of horizontal comparison
+     * values and masks.
+     */
+    static const u8 horizontal[][2] = {
+
+        { 0x00, 0xFF }, { 0xFE, 0xFF }, { 0x80, 0xFF }, { 0xE0, 0xFF },
+        { 0xE2, 0xFF }, { 0x40, 0x41 }, { 0x02, 0x03 }, { 0x90, 0x11 }
+    };
+
+    auto savedPos = agnus.pos;
+    auto savedIns1 = cop1ins;
+    auto savedIns2 = cop2ins;
+    isize turn = 0;
+    u16 sweep = 0;
+
+    for (auto type : { PAL, NTSC }) {
+
+        for (bool lof : { false, true }) {
+
+            agnus.pos.type = type;
+            agnus.pos.lof = lof;
+
+            for (isize v = 0; v < agnus.pos.vCnt(); v++) {
+
+                agnus.pos.v = v;
+
+                for (u32 vp = 0; vp < 0x100; vp++) {
+
+                    for (u32 vm = 0; vm < 0x80; vm++) {
+
+                        for (usize i = 0; i <= std::size(horizontal); i++) {
+
+                            bool swept = i == std::size(horizontal);
+                            u32 hp = swept ? LO_BYTE(sweep) : horizontal[i][0];
+                            u32 hm = swept ? HI_BYTE(sweep) : horizontal[i][1];
+                            if (swept) sweep++;
+
+                            agnus.pos.h = turn++ % HPOS_CNT_PAL;
+                            cop1ins = u16(vp << 8 | hp);
+                            cop2ins = u16(vm << 8 | hm);
+
+                            Beam match1 = { }, match2 = { };
+                            auto hit1 = findMatch(match1);
+                            auto hit2 = findMatchOld(match2);
+
+                            if (hit1 != hit2 || (hit1 && (match1.v != match2.v ||
+                                                          match1.h != match2.h))) {
+                                failures[2]++;
+                            }
+                            cases[2]++;
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+    agnus.pos = savedPos;
+    cop1ins = savedIns1;
+    cop2ins = savedIns2;
+
+    // Print the results
+    const char *names[] = { "nextMatch", "findHorizontalMatch", "findMatch" };
+
+    for (isize i = 0; i < 3; i++) {
+
+        os << tab(names[i]);
+        os << dec(cases[i]) << " cases, " << dec(failures[i]) << " mismatches" << std::endl;
+    }
+}
+
 void
 Copper::move(u32 addr, u16 value)
 {
@@ -212,6 +475,7 @@ Copper::move(u32 addr, u16 value)
 
         // Color registers
         pixelEngine.colChanges.insert(agnus.pos.pixel(), RegChange { addr, value} );
+        mem.histogram.write <ACCESSOR_AGNUS> (addr);
         return;
     }
 
@@ -258,7 +522,16 @@ Copper::scheduleWaitWakeup(bool bfd)
     Beam trigger;
 
     // Find the trigger position for this WAIT command
-    if (findMatch(trigger)) {
+    bool hit = findMatch(trigger);
+
+    if constexpr (COP_DEBUG) {
+
+        Beam ref;
+        assert(hit == findMatchOld(ref));
+        assert(!hit || (ref.v == trigger.v && ref.h == trigger.h));
+    }
+
+    if (hit) {
 
         // In how many cycles do we get there?
         // auto delay = agnus.frame.diff(trigger.v, trigger.h, agnus.pos.v, agnus.pos.h);
@@ -395,7 +668,13 @@ Copper::getVMHM(u32 addr) const
 bool
 Copper::isIllegalAddress(u32 addr) const
 {
-    if (cdang) {
+    return isIllegalAddress(addr, cdang);
+}
+
+bool
+Copper::isIllegalAddress(u32 addr, bool danger) const
+{
+    if (danger) {
         return agnus.isOCS() ? addr < 0x40 : false;
     } else {
         return addr < 0x80;
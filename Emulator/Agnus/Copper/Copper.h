@@ -17,6 +17,31 @@
 #include "CopperDebugger.h"
 #include "Memory.h"
 
+struct CopperRecord
+{
+    // Instruction types as seen by the Copper's state machine
+    enum class Op : u8 { Move, Jump1, Jump2, Wait, Skip };
+
+    // Address of the first instruction word (odd = record is empty)
+    u32 addr;
+
+    // Generation of the Chip Ram page holding the instruction
+    u32 generation;
+
+    // The instruction words
+    u16 cop1ins;
+    u16 cop2ins;
+
+    // The decoded instruction
+    Op op;
+
+    // Target register of a MOVE
+    u16 reg;
+
+    // Indicates if the MOVE target is illegal with CDANG cleared or set
+    bool illegal[2];
+};
+
 class Copper : public SubComponent
 {
     friend class Agnus;
@@ -64,6 +89,20 @@ private:
      */
     bool activeInThisFrame = false;
 
+    /* Predecode cache. Copper lists hardly ever change from frame to frame.
+     * Hence, each instruction is decoded once and the result is stored in a
+     * direct-mapped cache, keyed by the instruction address. The Copper still
+     * reads each instruction word in its DMA cycle, which keeps the timing
+     * and the bus values exact. A record is only used if both instruction
+     * words match the fetched words. If they differ, the Copper list has been
+     * modified and all records of the affected Chip Ram page are dropped.
+     */
+    static constexpr isize cacheSize = 8192;
+    std::vector<CopperRecord> cache = std::vector<CopperRecord>(cacheSize);
+    u32 pageGeneration[512] = { };
+    i64 cacheHits = 0;
+    i64 cacheMisses = 0;
+
 public:
 
     // Indicates if breakpoint or watchpoint checking is needed
@@ -110,7 +149,9 @@ private:
 private:
     
     void _reset(bool hard) override;
+    void _didLoad() override;
     void _inspect() const override;
+    isize _memoryFootprint() const override;
     
     template <class T>
     void applyToPersistentItems(T& worker)
@@ -185,6 +226,28 @@ private:
     // Switches the Copper list
     void switchToCopperList(isize nr);
 
+    // Returns the decoded version of the current instruction
+    const CopperRecord &decode() {
+
+        auto &rec = cache[(coppc0 >> 2) & (cacheSize - 1)];
+
+        if (rec.addr == coppc0 &&
+            rec.cop1ins == cop1ins &&
+            rec.cop2ins == cop2ins &&
+            rec.generation == pageGeneration[(coppc0 >> 12) & 511]) {
+
+            cacheHits++;
+            return rec;
+        }
+        return decode(rec);
+    }
+
+    // Decodes the current instruction into the provided cache record
+    const CopperRecord &decode(CopperRecord &rec);
+
+    // Deletes all records in the predecode cache
+    void clearCache();
+
     /* Searches for the next matching beam position. This function is called
      * when a WAIT statement is processed. It is uses to compute where the
      * Copper wakes up.
@@ -196,13 +259,32 @@ private:
      * false: The Copper does not wake up the current frame.
      *        Variable 'result' remains untouched.
      */
-    bool findMatchOld(Beam &result) const; // DEPRECATED
+    bool findMatchOld(Beam &result) const; // Reference for COP_DEBUG
     bool findMatch(Beam &result) const;
 
     // Called by findMatch() to determine the horizontal trigger position
-    bool findHorizontalMatchOld(u32 &beam, u32 comp, u32 mask) const; // DEPRECATED
+    bool findHorizontalMatchOld(u32 &beam, u32 comp, u32 mask) const; // Reference for COP_DEBUG
     bool findHorizontalMatch(u32 &beam, u32 comp, u32 mask) const;
 
+    /* Computes the smallest value >= start for which the comparator triggers,
+     * i.e., (value & mask) >= comp holds. Values up to 9 bits are considered.
+     * The function returns -1 if no such value exists.
+     */
+    static isize nextMatch(u32 start, u32 comp, u32 mask);
+
+public:
+
+    /* Compares the closed-form WAIT search with the iterative reference code.
+     * nextMatch() is checked against a brute-force search for all arguments.
+     * findHorizontalMatch() is checked for all horizontal positions, all
+     * comparison values, and all masks. findMatch() is checked for all frame
+     * types, lines, vertical comparison values, and vertical masks. The
+     * function must only be called while the emulator is powered off.
+     */
+    void selfTest(std::ostream& os) throws;
+
+private:
+
     // Emulates the Copper writing a value into one of the custom registers
     void move(u32 addr, u16 value);
 
@@ -289,6 +371,7 @@ public:
     
     // Returns true if the Copper has no access to this custom register
     bool isIllegalAddress(u32 addr) const;
+    bool isIllegalAddress(u32 addr, bool danger) const;
     
     // Returns true if the Copper instruction at addr is illegal
     bool isIllegalInstr(u32 addr) const;
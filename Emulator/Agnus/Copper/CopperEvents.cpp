@@ -134,30 +134,32 @@ Copper::serviceEvent(EventID id)
 
             if (COP_CHECKSUM) checksum = util::fnvIt32(checksum, cop2ins);
 
-            // Extract register number from the first instruction word
-            reg = (cop1ins & 0x1FE);
+            {   // Get the decoded instruction
+                auto &rec = decode();
+                reg = rec.reg;
 
-            // Stop the Copper if address is illegal
-            if (isIllegalAddress(reg)) { agnus.cancel<SLOT_COP>(); break; }
+                // Stop the Copper if address is illegal
+                if (rec.illegal[cdang]) { agnus.cancel<SLOT_COP>(); break; }
 
-            // Continue with fetching the new command
-            schedule(COP_FETCH);
+                // Continue with fetching the new command
+                schedule(COP_FETCH);
 
-            // Only proceed if the skip flag is not set
-            if (skip) { skip = false; break; }
-
-            // Write value into custom register
-            switch (reg) {
-                case 0x88:
-                    schedule(COP_JMP1);
-                    agnus.data[SLOT_COP] = 1;
-                    break;
-                case 0x8A:
-                    schedule(COP_JMP1);
-                    agnus.data[SLOT_COP] = 2;
-                    break;
-                default:
-                    move(reg, cop2ins);
+                // Only proceed if the skip flag is not set
+                if (skip) { skip = false; break; }
+
+                // Write value into custom register
+                switch (rec.op) {
+                    case CopperRecord::Op::Jump1:
+                        schedule(COP_JMP1);
+                        agnus.data[SLOT_COP] = 1;
+                        break;
+                    case CopperRecord::Op::Jump2:
+                        schedule(COP_JMP1);
+                        agnus.data[SLOT_COP] = 2;
+                        break;
+                    default:
+                        move(reg, cop2ins);
+                }
             }
             
             // Check if a watchpoint has been reached
@@ -181,7 +183,7 @@ Copper::serviceEvent(EventID id)
             if (COP_CHECKSUM) checksum = util::fnvIt32(checksum, cop2ins);
 
             // Fork execution depending on the instruction type
-            schedule(isWaitCmd() ? COP_WAIT1 : COP_SKIP1);
+            schedule(decode().op == CopperRecord::Op::Wait ? COP_WAIT1 : COP_SKIP1);
             break;
 
         case COP_WAIT1:
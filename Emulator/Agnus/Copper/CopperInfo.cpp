@@ -22,6 +22,10 @@ Copper::_dump(Category category, std::ostream& os) const
         os << dec(copList) << std::endl;
         os << tab("Skip flag");
         os << bol(skip) << std::endl;
+        os << tab("Cache hits");
+        os << dec(cacheHits) << std::endl;
+        os << tab("Cache misses");
+        os << dec(cacheMisses) << std::endl;
     }
             
     if (category == Category::Registers) {
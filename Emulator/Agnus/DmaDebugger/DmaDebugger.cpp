@@ -10,11 +10,25 @@
 #include "config.h"
 #include "DmaDebugger.h"
 #include "Amiga.h"
+#include "IOUtils.h"
+#include <algorithm>
+#include <fstream>
+
+static_assert(sizeof(DmaTimelineHeader) == 32);
+static_assert(sizeof(DmaTimelineSlot) == 16);
+static_assert(SLOT_COUNT <= 64);
 
 DmaDebugger::DmaDebugger(Amiga &ref) : SubComponent(ref)
 {
 }
 
+isize
+DmaDebugger::_memoryFootprint() const
+{
+    return isize(lineUsage.capacity() * sizeof(BusUsage) +
+                 timeline.capacity() * sizeof(DmaTimelineSlot));
+}
+
 void
 DmaDebugger::resetConfig()
 {
@@ -303,6 +317,12 @@ DmaDebugger::setColor(BusOwner owner, u32 rgba)
 void
 DmaDebugger::eolHandler()
 {
+    // Record bus usage statistics if requested
+    if (profiling) recordBusUsage();
+
+    // Record the DMA slots of the current line if requested
+    if (recordingTimeline) recordTimelineLine();
+
     // Only proceed if DMA debugging has been turned on
     if (!config.enabled) return;
 
@@ -418,3 +438,311 @@ DmaDebugger::vSyncHandler()
         }
     }
 }
+
+void
+DmaDebugger::eofHandler()
+{
+    // Complete a running timeline recording
+    if (recordingTimeline) {
+
+        recordingTimeline = false;
+        recordedFrame = agnus.pos.frame - 1;
+        timelineFrame = -1;
+    }
+
+    // Start a requested timeline recording
+    if (timelineFrame >= 0 && agnus.pos.frame >= timelineFrame) {
+
+        recordingTimeline = true;
+        recordedFrame = -1;
+        timelineLines = 0;
+    }
+
+    if (!profiling) return;
+
+    for (isize i = 0; i < BUS_COUNT; i++) totalUsage.slots[i] += frameUsage.slots[i];
+    totalUsage.cpuWait += frameUsage.cpuWait;
+    totalUsage.cpuStalls += frameUsage.cpuStalls;
+    totalUsage.lines += frameUsage.lines;
+
+    latestUsage = frameUsage;
+    frameUsage = { };
+    profiledFrames++;
+}
+
+void
+DmaDebugger::startProfiling()
+{
+    {   SUSPENDED
+
+        frameUsage = { };
+        latestUsage = { };
+        totalUsage = { };
+        profiledFrames = 0;
+        lineUsage.assign(VPOS_CNT, BusUsage { });
+
+        profiling = true;
+    }
+}
+
+void
+DmaDebugger::stopProfiling()
+{
+    {   SUSPENDED
+
+        profiling = false;
+    }
+}
+
+void
+DmaDebugger::recordBusUsage()
+{
+    auto &line = lineUsage[agnus.pos.v];
+
+    // At this point, pos.h contains the length of the current line
+    for (isize h = 0; h < agnus.pos.h; h++) {
+
+        auto owner = agnus.busOwner[h];
+        frameUsage.slots[owner]++;
+        line.slots[owner]++;
+    }
+    frameUsage.lines++;
+    line.lines++;
+}
+
+void
+DmaDebugger::dumpProfile(std::ostream& os) const
+{
+    using namespace util;
+
+    char buf[64];
+
+    auto percentage = [](const BusUsage &usage, isize owner) {
+
+        i64 sum = 0;
+        for (isize i = 0; i < BUS_COUNT; i++) sum += usage.slots[i];
+        return sum ? 100.0 * double(usage.slots[owner]) / double(sum) : 0.0;
+    };
+    auto average = [&](i64 value) {
+        return profiledFrames ? double(value) / double(profiledFrames) : 0.0;
+    };
+
+    os << tab("Profiling");
+    os << bol(profiling) << std::endl;
+    os << tab("Frames");
+    os << dec(profiledFrames) << std::endl;
+
+    if (profiledFrames == 0) return;
+
+    // Slot utilization per bus owner (latest frame, all frames)
+    os << std::endl;
+    os << tab("Slots") << "  Latest       Total" << std::endl;
+    for (isize i = 0; i < BUS_COUNT; i++) {
+
+        if (totalUsage.slots[i] == 0) continue;
+
+        snprintf(buf, sizeof(buf), "%6.2f %%    %6.2f %%",
+                 percentage(latestUsage, i), percentage(totalUsage, i));
+        os << tab(i == BUS_NONE ? "Free" : BusOwnerEnum::key(BusOwner(i)));
+        os << buf << std::endl;
+    }
+
+    // CPU wait cycles (latest frame, average per frame)
+    os << std::endl;
+    os << tab("CPU wait cycles");
+    os << dec(latestUsage.cpuWait) << " DMA cycles in the latest frame" << std::endl;
+    snprintf(buf, sizeof(buf), "%.1f", average(totalUsage.cpuWait));
+    os << tab("");
+    os << buf << " DMA cycles per frame on average" << std::endl;
+    os << tab("CPU stalls");
+    os << dec(latestUsage.cpuStalls) << " in the latest frame" << std::endl;
+    snprintf(buf, sizeof(buf), "%.1f", average(totalUsage.cpuStalls));
+    os << tab("");
+    os << buf << " per frame on average" << std::endl;
+
+    // Lines with the highest number of CPU wait cycles
+    std::vector<std::pair<i64, isize>> lines;
+    for (isize v = 0; v < isize(lineUsage.size()); v++) {
+        if (lineUsage[v].cpuWait) lines.push_back( { lineUsage[v].cpuWait, v } );
+    }
+    std::sort(lines.begin(), lines.end(), std::greater<>());
+
+    if (lines.empty()) return;
+
+    os << std::endl;
+    for (isize i = 0; i < std::min(isize(lines.size()), isize(10)); i++) {
+
+        auto &usage = lineUsage[lines[i].second];
+        auto n = double(std::max(usage.lines, i64(1)));
+
+        snprintf(buf, sizeof(buf), "Line %ld", long(lines[i].second));
+        os << tab(buf);
+        snprintf(buf, sizeof(buf), "%.1f wait cycles, %.1f stalls, %.1f %% free",
+                 double(usage.cpuWait) / n, double(usage.cpuStalls) / n,
+                 percentage(usage, BUS_NONE));
+        os << buf << std::endl;
+    }
+}
+
+void
+DmaDebugger::exportProfile(const string &path) const
+{
+    std::ofstream stream(path);
+    if (!stream.is_open()) throw VAError(ERROR_FILE_CANT_CREATE, path);
+
+    // Write the header
+    stream << "line,count,cpu_wait,cpu_stalls";
+    for (isize i = 0; i < BUS_COUNT; i++) stream << "," << BusOwnerEnum::key(BusOwner(i));
+    stream << "\n";
+
+    // Write a line for each recorded scanline
+    for (isize v = 0; v < isize(lineUsage.size()); v++) {
+
+        auto &usage = lineUsage[v];
+        if (usage.lines == 0) continue;
+
+        stream << v << "," << usage.lines << "," << usage.cpuWait << "," << usage.cpuStalls;
+        for (isize i = 0; i < BUS_COUNT; i++) stream << "," << usage.slots[i];
+        stream << "\n";
+    }
+}
+
+void
+DmaDebugger::recordTimeline(i64 frame)
+{
+    {   SUSPENDED
+
+        timeline.assign(VPOS_CNT * HPOS_CNT, DmaTimelineSlot { });
+        timelineFrame = std::max(frame, agnus.pos.frame + 1);
+        recordingTimeline = false;
+        recordedFrame = -1;
+        timelineLines = 0;
+    }
+}
+
+void
+DmaDebugger::recordEvents(u64 slots)
+{
+    if (!recordingTimeline || agnus.pos.h >= HPOS_CNT) return;
+
+    // Ignore the slots that only enable secondary and tertiary slots
+    slots &= ~(u64(1) << SLOT_SEC | u64(1) << SLOT_TER);
+
+    timeline[agnus.pos.v * HPOS_CNT + agnus.pos.h].events |= slots;
+}
+
+void
+DmaDebugger::recordTimelineLine()
+{
+    auto *line = timeline.data() + agnus.pos.v * HPOS_CNT;
+
+    // At this point, pos.h contains the length of the current line
+    for (isize h = 0; h < HPOS_CNT; h++) {
+
+        if (h < agnus.pos.h) {
+
+            line[h].owner = u8(agnus.busOwner[h]);
+            line[h].value = agnus.busValue[h];
+
+        } else {
+
+            line[h].owner = 0xFF;
+        }
+    }
+    timelineLines = agnus.pos.v + 1;
+}
+
+void
+DmaDebugger::dumpTimeline(std::ostream& os) const
+{
+    using namespace util;
+
+    os << tab("Requested frame");
+    os << (timelineFrame >= 0 ? std::to_string(timelineFrame) : "-") << std::endl;
+    os << tab("Recording");
+    os << bol(recordingTimeline) << std::endl;
+    os << tab("Recorded frame");
+    os << (recordedFrame >= 0 ? std::to_string(recordedFrame) : "-") << std::endl;
+
+    if (recordedFrame < 0) return;
+
+    os << tab("Lines");
+    os << dec(timelineLines) << std::endl;
+
+    // Count the slots assigned to each bus owner and the serviced events
+    i64 slots[BUS_COUNT] = { };
+    i64 events[SLOT_COUNT] = { };
+
+    for (isize i = 0; i < timelineLines * HPOS_CNT; i++) {
+
+        auto &slot = timeline[i];
+        if (slot.owner < BUS_COUNT) slots[slot.owner]++;
+        for (isize j = 0; j < SLOT_COUNT; j++) events[j] += (slot.events >> j) & 1;
+    }
+
+    os << std::endl;
+    for (isize i = 0; i < BUS_COUNT; i++) {
+
+        if (slots[i] == 0) continue;
+        os << tab(i == BUS_NONE ? "Free" : BusOwnerEnum::key(BusOwner(i)));
+        os << dec(slots[i]) << " slots" << std::endl;
+    }
+
+    os << std::endl;
+    for (isize i = 0; i < SLOT_COUNT; i++) {
+
+        if (events[i] == 0) continue;
+        os << tab(string(EventSlotEnum::key(EventSlot(i))) + " events");
+        os << dec(events[i]) << std::endl;
+    }
+}
+
+void
+DmaDebugger::exportTimeline(const string &path) const
+{
+    std::ofstream stream(path, std::ios::binary);
+    if (!stream.is_open()) throw VAError(ERROR_FILE_CANT_CREATE, path);
+
+    auto lines = recordedFrame >= 0 ? timelineLines : 0;
+
+    DmaTimelineHeader header = {
+
+        { 'V', 'A', 'D', 'M', 'A', 'T', 'L', 0 },
+        timelineVersion,
+        u32(lines),
+        u32(HPOS_CNT),
+        u32(SLOT_COUNT),
+        recordedFrame
+    };
+
+    stream.write((const char *)&header, sizeof(header));
+    stream.write((const char *)timeline.data(), lines * HPOS_CNT * sizeof(DmaTimelineSlot));
+}
+
+void
+DmaDebugger::exportTimelinePPM(const string &path) const
+{
+    std::ofstream stream(path, std::ios::binary);
+    if (!stream.is_open()) throw VAError(ERROR_FILE_CANT_CREATE, path);
+
+    auto lines = recordedFrame >= 0 ? timelineLines : 0;
+
+    // Unused slots are drawn in dark grey, blocked slots in white
+    std::vector<u8> image(lines * HPOS_CNT * 3, 0);
+
+    for (isize i = 0; i < lines * HPOS_CNT; i++) {
+
+        auto owner = timeline[i].owner;
+        auto color =
+        owner == BUS_NONE ? RgbColor(u8(0x30), u8(0x30), u8(0x30)) :
+        owner == BUS_BLOCKED ? RgbColor::white :
+        owner < BUS_COUNT ? debugColor[owner][2] : RgbColor::black;
+
+        image[3 * i + 0] = u8(color.r * 255.0);
+        image[3 * i + 1] = u8(color.g * 255.0);
+        image[3 * i + 2] = u8(color.b * 255.0);
+    }
+
+    stream << "P6\n" << HPOS_CNT << " " << lines << "\n255\n";
+    stream.write((const char *)image.data(), image.size());
+}
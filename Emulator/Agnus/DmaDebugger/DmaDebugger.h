@@ -14,6 +14,7 @@
 #include "SubComponent.h"
 #include "Colors.h"
 #include "Constants.h"
+#include <vector>
 
 class DmaDebugger : public SubComponent {
 
@@ -35,6 +36,35 @@ class DmaDebugger : public SubComponent {
     // HSYNC handler information (recorded in the EOL handler)
     isize pixel0 = 0;
 
+    // Indicates if bus usage statistics are recorded
+    bool profiling = false;
+
+    // Bus usage of the current frame and the latest completed frame
+    BusUsage frameUsage = {};
+    BusUsage latestUsage = {};
+
+    // Bus usage accumulated over all completed frames
+    BusUsage totalUsage = {};
+    i64 profiledFrames = 0;
+
+    // Bus usage accumulated per scanline (allocated when profiling starts)
+    std::vector<BusUsage> lineUsage;
+
+    // Frame to be recorded by the timeline recorder (-1 if none is requested)
+    i64 timelineFrame = -1;
+
+    // Indicates if the current frame is recorded
+    bool recordingTimeline = false;
+
+    // Number of the latest recorded frame (-1 if none has been recorded)
+    i64 recordedFrame = -1;
+
+    // Number of lines the latest recorded frame consists of
+    isize timelineLines = 0;
+
+    // Recorded DMA slots, line by line (allocated when a recording is requested)
+    std::vector<DmaTimelineSlot> timeline;
+
 
     //
     // Initializing
@@ -62,6 +92,7 @@ private:
 private:
     
     void _reset(bool hard) override { }
+    isize _memoryFootprint() const override;
 
 
     //
@@ -93,6 +124,79 @@ public:
     // Returns the result of the most recent call to inspect()
     DmaDebuggerInfo getInfo();
 
+
+    //
+    // Profiling bus usage
+    //
+
+public:
+
+    // Starts recording bus usage statistics (all counters are cleared)
+    void startProfiling();
+
+    // Stops recording bus usage statistics (the recorded data is kept)
+    void stopProfiling();
+
+    // Returns true if bus usage statistics are recorded
+    bool isProfiling() const { return profiling; }
+
+    // Called by Agnus when the CPU had to wait for the bus
+    void recordCpuWait(isize vpos, DMACycle delay) {
+
+        if (profiling) {
+
+            frameUsage.cpuWait += delay;
+            frameUsage.cpuStalls++;
+            lineUsage[vpos].cpuWait += delay;
+            lineUsage[vpos].cpuStalls++;
+        }
+    }
+
+    // Prints a bus utilization report
+    void dumpProfile(std::ostream& os) const;
+
+    /* Writes the per-line statistics into a CSV file. Each line contains the
+     * accumulated CPU wait cycles, the number of stalls, and the number of
+     * slots assigned to each bus owner for a single scanline.
+     */
+    void exportProfile(const string &path) const throws;
+
+
+    //
+    // Recording frame timelines
+    //
+
+public:
+
+    // File format version of exported timelines
+    static constexpr u32 timelineVersion = 1;
+
+    /* Requests the DMA slot allocation of a frame to be recorded. The
+     * recording takes place when the specified frame is emulated. If the
+     * frame has already started, the next frame is recorded.
+     */
+    void recordTimeline(i64 frame);
+
+    // Returns true if a timeline recording is pending or in progress
+    bool isRecordingTimeline() const { return timelineFrame >= 0; }
+
+    // Called by Agnus with the event slots serviced in the current cycle
+    void recordEvents(u64 slots);
+
+    // Prints the state of the timeline recorder
+    void dumpTimeline(std::ostream& os) const;
+
+    /* Writes the latest recorded timeline into a binary file. The file
+     * starts with a DmaTimelineHeader, followed by a DmaTimelineSlot for
+     * each DMA cycle in line-by-line order.
+     */
+    void exportTimeline(const string &path) const throws;
+
+    /* Writes the latest recorded timeline into a PPM image. Each DMA cycle
+     * is drawn as a single pixel in the color of its bus owner.
+     */
+    void exportTimelinePPM(const string &path) const throws;
+
     
     //
     // Serializing
@@ -121,8 +225,17 @@ public:
     // Cleans by Agnus at the end of each frame
     void vSyncHandler();
 
+    // Called by Agnus when a frame has been completed
+    void eofHandler();
+
 private:
 
+    // Adds the bus owners of the current line to the bus usage statistics
+    void recordBusUsage();
+
+    // Adds the bus owners of the current line to the recorded timeline
+    void recordTimelineLine();
+
     // Visualizes DMA usage for a certain range of DMA cycles
     void computeOverlay(Texel *ptr, isize first, isize last, BusOwner *own, u16 *val);
 };
@@ -129,3 +129,56 @@ typedef struct
     double refreshColor[3];
 }
 DmaDebuggerInfo;
+
+typedef struct
+{
+    // Number of DMA slots assigned to each bus owner
+    i64 slots[BUS_COUNT];
+
+    // Number of DMA cycles the CPU has been waiting for the bus
+    i64 cpuWait;
+
+    // Number of CPU accesses that have been delayed
+    i64 cpuStalls;
+
+    // Number of recorded scanlines
+    i64 lines;
+}
+BusUsage;
+
+typedef struct
+{
+    // Magic bytes ("VADMATL")
+    char magic[8];
+
+    // Version of the file format
+    u32 version;
+
+    // Number of recorded scanlines
+    u32 lines;
+
+    // Number of slots per scanline
+    u32 slots;
+
+    // Number of event slots (bit positions in DmaTimelineSlot::events)
+    u32 eventSlots;
+
+    // Number of the recorded frame
+    i64 frame;
+}
+DmaTimelineHeader;
+
+typedef struct
+{
+    // Event slots that have been serviced in this DMA cycle (bit n = slot n)
+    u64 events;
+
+    // Value on the data bus
+    u16 value;
+
+    // Bus owner (BusOwner) or 0xFF if the slot is beyond the end of the line
+    u8 owner;
+
+    u8 reserved[5];
+}
+DmaTimelineSlot;
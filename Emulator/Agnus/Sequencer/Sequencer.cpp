@@ -23,6 +23,13 @@ Sequencer::_reset(bool hard)
     
     initBplEvents();
     initDasEvents();
+    clearBplTableCache();
+}
+
+isize
+Sequencer::_memoryFootprint() const
+{
+    return isize(bplTableCache.capacity() * sizeof(BplTableCacheEntry));
 }
 
 void
@@ -113,6 +113,26 @@ static constexpr usize UPDATE_SIG_RECORDER  = 0b001;
 static constexpr usize UPDATE_BPL_TABLE     = 0b010;
 static constexpr usize UPDATE_DAS_TABLE     = 0b100;
 
+struct BplTableCacheEntry
+{
+    // Maximum number of recorded signals a cacheable table may depend on
+    static constexpr isize maxSignals = 16;
+
+    // Lookup key (0 = entry is empty)
+    isize len;
+    u64 key[maxSignals + 1];
+
+    // The computed tables
+    EventID bplEvent[HPOS_CNT];
+    u8 nextBplEvent[HPOS_CNT];
+
+    // Display logic state at the end of the line
+    DDFState state;
+
+    // Indicates if the line has been classified as a non-blank line
+    bool vflop;
+};
+
 class Sequencer : public SubComponent
 {
     friend class Agnus;
@@ -196,6 +216,19 @@ private:
     
     // Action flags controlling the HSYNC handler
     usize hsyncActions;
+
+    /* Bitplane table cache. Most scanlines of a frame replay the same set of
+     * recorded signals with the same initial state. To speed things up, the
+     * computed event tables are stored in a direct-mapped cache. The lookup
+     * key comprises all inputs of the table computation, which are the
+     * initial display logic state, the recorded signals, the scroll values,
+     * and the chipset revision. Hence, an entry never has to be invalidated.
+     */
+    static constexpr isize bplTableCacheSize = 128;
+    std::vector<BplTableCacheEntry> bplTableCache =
+        std::vector<BplTableCacheEntry>(bplTableCacheSize);
+    i64 bplTableCacheHits = 0;
+    i64 bplTableCacheMisses = 0;
     
     
     //
@@ -228,6 +261,7 @@ private:
     private:
 
     void _reset(bool hard) override;
+    isize _memoryFootprint() const override;
 
     template <class T>
     void applyToPersistentItems(T& worker)
@@ -314,6 +348,12 @@ private:
     template <bool ecs> void computeBplEventsFast(const SigRecorder &sr, DDFState &state);
     template <bool ecs> void computeBplEvents(isize strt, isize stop, DDFState &state);
 
+    // Computes the lookup key for the bitplane table cache (0 = not cacheable)
+    isize computeBplTableKey(const SigRecorder &sr, const DDFState &state, u64 *key) const;
+
+    // Deletes all entries in the bitplane table cache
+    void clearBplTableCache();
+
     // Processes a signal change
     template <bool ecs> void processSignal(u32 signal, DDFState &state);
  
@@ -10,6 +10,7 @@
 #include "config.h"
 #include "Sequencer.h"
 #include "Agnus.h"
+#include <cstring>
 
 void
 Sequencer::initBplEvents()
@@ -52,16 +53,56 @@ Sequencer::computeBplEventTable(const SigRecorder &sr)
     
     // Evaluate the current state of the vertical DIW flipflop
     if (!state.bpv) { state.bprun = false; state.cnt = 0; }
-    
-    // Fill the event table
-    if (sr.modified || (state.bpv && state.bmapen) || NO_SEQ_FASTPATH) {
-        computeBplEventsSlow <ecs> (sr, state);
+
+    // Check if the tables have been computed before
+    u64 key[BplTableCacheEntry::maxSignals + 1];
+    auto len = computeBplTableKey(sr, state, key);
+
+    // Determine the cache line by folding all key words (FNV-style)
+    u64 hash = 0;
+    for (isize i = 0; i < len; i++) hash = (hash ^ key[i]) * 0x100000001B3;
+    auto &entry = bplTableCache[(hash ^ hash >> 32) & (bplTableCacheSize - 1)];
+
+    if (len && entry.len == len && std::memcmp(entry.key, key, len * 8) == 0) {
+
+        bplTableCacheHits++;
+
+        std::memcpy(bplEvent, entry.bplEvent, sizeof(bplEvent));
+        std::memcpy(nextBplEvent, entry.nextBplEvent, sizeof(nextBplEvent));
+        state = entry.state;
+        computeFetchUnit(state.bplcon0);
+        if (entry.vflop) lineIsBlank = false;
+
     } else {
-        computeBplEventsFast <ecs> (sr, state);
+
+        bplTableCacheMisses++;
+
+        auto wasBlank = lineIsBlank;
+        lineIsBlank = true;
+
+        // Fill the event table
+        if (sr.modified || (state.bpv && state.bmapen) || NO_SEQ_FASTPATH) {
+            computeBplEventsSlow <ecs> (sr, state);
+        } else {
+            computeBplEventsFast <ecs> (sr, state);
+        }
+
+        // Update the jump table
+        updateBplJumpTable();
+
+        // Store the result
+        if (len) {
+
+            entry.len = len;
+            std::memcpy(entry.key, key, len * 8);
+            std::memcpy(entry.bplEvent, bplEvent, sizeof(bplEvent));
+            std::memcpy(entry.nextBplEvent, nextBplEvent, sizeof(nextBplEvent));
+            entry.state = state;
+            entry.vflop = !lineIsBlank;
+        }
+
+        lineIsBlank &= wasBlank;
     }
-    
-    // Update the jump table
-    updateBplJumpTable();
 
     // Rectify the scheduled event
     agnus.scheduleBplEventForCycle(agnus.pos.h);
@@ -77,6 +118,44 @@ Sequencer::computeBplEventTable(const SigRecorder &sr)
     }
 }
 
+isize
+Sequencer::computeBplTableKey(const SigRecorder &sr, const DDFState &state, u64 *key) const
+{
+    auto count = sigRecorder.count();
+    if (count > BplTableCacheEntry::maxSignals) return 0;
+
+    // Pack the initial state, the scroll values, and the chipset revision
+    key[0] =
+    u64(state.bpv)              |
+    u64(state.bmapen)   << 1    |
+    u64(state.shw)      << 2    |
+    u64(state.rhw)      << 3    |
+    u64(state.bphstart) << 4    |
+    u64(state.bphstop)  << 5    |
+    u64(state.bprun)    << 6    |
+    u64(state.lastFu)   << 7    |
+    u64(state.stopreq)  << 8    |
+    u64(state.cnt)      << 9    |
+    u64(sr.modified)    << 12   |
+    u64(agnus.isECS())  << 13   |
+    u64(state.bplcon0)  << 16   |
+    u64(u8(agnus.scrollOdd)) << 32 |
+    u64(u8(agnus.scrollEven)) << 40;
+
+    // Append the recorded signals
+    for (isize i = 0; i < count; i++) {
+        key[i + 1] = u64(sigRecorder.keys[i]) << 32 | sigRecorder.elements[i];
+    }
+
+    return count + 1;
+}
+
+void
+Sequencer::clearBplTableCache()
+{
+    for (auto &entry : bplTableCache) entry.len = 0;
+}
+
 template <bool ecs> void
 Sequencer::computeBplEventsFast(const SigRecorder &sr, DDFState &state)
 {
@@ -41,6 +41,10 @@ Sequencer::_dump(Category category, std::ostream& os) const
         os << hex(ddf.bplcon0) << " (" << hex(ddfInitial.bplcon0) << ")" << std::endl;
         os << tab("CNT");
         os << dec(ddf.cnt) << " (" << dec(ddfInitial.cnt) << ")" << std::endl;
+        os << tab("Table cache hits");
+        os << dec(bplTableCacheHits) << std::endl;
+        os << tab("Table cache misses");
+        os << dec(bplTableCacheMisses) << std::endl;
     }
      
     if (category == Category::Registers) {
@@ -196,7 +196,8 @@ Amiga::resetConfig()
 
     std::vector <Option> options = {
 
-        OPT_VIDEO_FORMAT
+        OPT_VIDEO_FORMAT,
+        OPT_ADAPTIVE_ACCURACY
     };
 
     for (auto &option : options) {
@@ -213,6 +214,10 @@ Amiga::getConfigItem(Option option) const
 
             return config.type;
 
+        case OPT_ADAPTIVE_ACCURACY:
+
+            return config.adaptiveAccuracy;
+
         case OPT_AGNUS_REVISION:
         case OPT_SLOW_RAM_MIRROR:
         case OPT_PTR_DROPS:
@@ -264,6 +269,7 @@ Amiga::getConfigItem(Option option) const
         case OPT_BANKMAP:
         case OPT_UNMAPPING_TYPE:
         case OPT_RAM_INIT_PATTERN:
+        case OPT_MEM_STATS:
             
             return mem.getConfigItem(option);
             
@@ -276,6 +282,7 @@ Amiga::getConfigItem(Option option) const
             return paula.muxer.getConfigItem(option);
 
         case OPT_BLITTER_ACCURACY:
+        case OPT_BLITTER_ASYNC:
             
             return agnus.blitter.getConfigItem(option);
 
@@ -394,6 +401,11 @@ Amiga::setConfigItem(Option option, i64 value)
             }
             return;
 
+        case OPT_ADAPTIVE_ACCURACY:
+
+            config.adaptiveAccuracy = value;
+            return;
+
         default:
             fatalError;
     }
@@ -430,6 +442,7 @@ Amiga::configure(Option option, i64 value)
     switch (option) {
 
         case OPT_VIDEO_FORMAT:
+        case OPT_ADAPTIVE_ACCURACY:
 
             setConfigItem(option, value);
             break;
@@ -495,6 +508,12 @@ Amiga::configure(Option option, i64 value)
             mem.setConfigItem(option, value);
             break;
 
+        case OPT_MEM_STATS:
+
+            mem.setConfigItem(option, value);
+            agnus.setConfigItem(option, value);
+            break;
+
         case OPT_DRIVE_TYPE:
         case OPT_EMULATE_MECHANICS:
         case OPT_START_DELAY:
@@ -550,6 +569,7 @@ Amiga::configure(Option option, i64 value)
             break;
 
         case OPT_BLITTER_ACCURACY:
+        case OPT_BLITTER_ASYNC:
             
             agnus.blitter.setConfigItem(option, value);
             break;
@@ -873,6 +893,17 @@ Amiga::_inspect() const
     }
 }
 
+isize
+Amiga::_memoryFootprint() const
+{
+    isize result = 0;
+
+    if (autoSnapshot) result += isizeof(Snapshot) + autoSnapshot->data.bytesize();
+    if (userSnapshot) result += isizeof(Snapshot) + userSnapshot->data.bytesize();
+
+    return result;
+}
+
 void
 Amiga::_dump(Category category, std::ostream& os) const
 {
@@ -881,7 +912,9 @@ Amiga::_dump(Category category, std::ostream& os) const
     if (category == Category::Config) {
 
         os << tab("Video format");
-        os << VideoFormatEnum::key(config.type);
+        os << VideoFormatEnum::key(config.type) << std::endl;
+        os << tab("Adaptive accuracy");
+        os << bol(config.adaptiveAccuracy) << std::endl;
     }
 
     if (category == Category::State) {
@@ -892,6 +925,8 @@ Amiga::_dump(Category category, std::ostream& os) const
         os << bol(isRunning()) << std::endl;
         os << tab("Warp mode");
         os << bol(inWarpMode()) << std::endl;
+        os << tab("Reduced accuracy");
+        os << bol(reducedAccuracy) << std::endl;
         os << tab("Debug mode");
         os << bol(inDebugMode()) << std::endl;
     }
@@ -900,6 +935,21 @@ Amiga::_dump(Category category, std::ostream& os) const
         
         defaults.dump(category, os);
     }
+
+    if (category == Category::Footprint) {
+
+        char header[96];
+        snprintf(header, sizeof(header), "%-28s%15s%15s", "Component", "Own", "Total");
+        os << header << std::endl;
+        dumpFootprint(os);
+        os << std::endl;
+        os << tab("Heap memory");
+        os << dec(memoryFootprint() / 1024) << " KB" << std::endl;
+        os << tab("Amiga object");
+        os << dec(sizeof(Amiga) / 1024) << " KB" << std::endl;
+        os << tab("Shared jump tables");
+        os << dec(moira::Moira::jumpTableFootprint() / 1024) << " KB" << std::endl;
+    }
 }
 
 void
@@ -1031,6 +1081,9 @@ Amiga::execute()
         // Check if special action needs to be taken
         if (flags) {
             
+            // Let the Blitter finish its background work
+            agnus.blitter.finishAsyncBlit();
+
             // Are we requested to take a snapshot?
             if (flags & RL::AUTO_SNAPSHOT) {
                 clearFlag(RL::AUTO_SNAPSHOT);
@@ -1165,6 +1218,18 @@ Amiga::clearFlag(u32 flag)
     flags &= ~flag;
 }
 
+void
+Amiga::adaptAccuracy()
+{
+    bool reduce = config.adaptiveAccuracy && inWarpMode();
+
+    if (reduce != reducedAccuracy) {
+
+        debug(RUN_DEBUG, "%s accuracy\n", reduce ? "Reducing" : "Restoring");
+        reducedAccuracy = reduce;
+    }
+}
+
 void
 Amiga::stopAndGo()
 {
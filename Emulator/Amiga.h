@@ -131,6 +131,13 @@ private:
      * repeats or terminates depending on the provided flags.
      */
     RunLoopFlags flags = 0;
+
+    /* Indicates if the emulator runs with reduced accuracy. This mode is
+     * entered at the beginning of a frame if warp mode is active and
+     * OPT_ADAPTIVE_ACCURACY is enabled. It is left at the beginning of the
+     * first frame after warp mode has been switched off.
+     */
+    bool reducedAccuracy = false;
                 
 
     //
@@ -203,6 +210,7 @@ private:
     void _debugOn() override;
     void _debugOff() override;
     void _inspect() const override;
+    isize _memoryFootprint() const override;
 
     template <class T>
     void applyToPersistentItems(T& worker)
@@ -300,6 +308,16 @@ public:
     void signalWarpOff() { setFlag(RL::WARP_OFF); }
     void signalAutoSnapshot() { setFlag(RL::AUTO_SNAPSHOT); }
     void signalUserSnapshot() { setFlag(RL::USER_SNAPSHOT); }
+
+    // Returns true if the emulator runs with reduced accuracy
+    bool inReducedAccuracyMode() const { return reducedAccuracy; }
+
+    /* Enters or leaves the reduced accuracy mode. The function is called by
+     * Agnus at the beginning of each frame. In this mode, the Blitter runs at
+     * accuracy level 0, the audio muxer uses no sample interpolation, and
+     * Denise only draws every 8th frame into the frame buffer.
+     */
+    void adaptAccuracy();
     
     // Runs or pauses the emulator
     void stopAndGo();
@@ -10,6 +10,7 @@
 #include "config.h"
 #include "AmigaComponent.h"
 #include "Checksum.h"
+#include <iostream>
 
 void
 AmigaComponent::initialize()
@@ -40,6 +41,32 @@ AmigaComponent::inspect() const
     _inspect();
 }
 
+isize
+AmigaComponent::memoryFootprint() const
+{
+    isize result = _memoryFootprint();
+
+    for (AmigaComponent *c : subComponents) { result += c->memoryFootprint(); }
+    return result;
+}
+
+void
+AmigaComponent::dumpFootprint(std::ostream& os, isize depth) const
+{
+    auto total = memoryFootprint();
+
+    // Skip subcomponents without any heap memory
+    if (depth && !total) return;
+
+    char line[96];
+    snprintf(line, sizeof(line), "%*s%-*s%12ld KB%12ld KB",
+             int(2 * depth), "", int(28 - 2 * depth), getDescription(),
+             long(_memoryFootprint() / 1024), long(total / 1024));
+    os << line << std::endl;
+
+    for (AmigaComponent *c : subComponents) { c->dumpFootprint(os, depth + 1); }
+}
+
 isize
 AmigaComponent::size()
 {
@@ -174,6 +174,18 @@ public:
             return cachedValues;
         }
     }
+
+    /* Returns the number of heap bytes owned by the component and it's
+     * subcomponents. Memory that is embedded in the component objects is not
+     * counted, as it is part of the Amiga object itself. Components owning
+     * heap memory report it by implementing the _memoryFootprint() delegation
+     * function.
+     */
+    isize memoryFootprint() const;
+    virtual isize _memoryFootprint() const { return 0; }
+
+    // Prints the memory footprint of the component and it's subcomponents
+    void dumpFootprint(std::ostream& os, isize depth = 0) const;
     
     //
     // Serializing
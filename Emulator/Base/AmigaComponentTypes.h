@@ -20,6 +20,7 @@ enum_long(OPT)
 {
     // Amiga
     OPT_VIDEO_FORMAT,
+    OPT_ADAPTIVE_ACCURACY,
     
     // Agnus
     OPT_AGNUS_REVISION,
@@ -62,6 +63,7 @@ enum_long(OPT)
     OPT_BANKMAP,
     OPT_UNMAPPING_TYPE,
     OPT_RAM_INIT_PATTERN,
+    OPT_MEM_STATS,
     
     // Disk controller
     OPT_DRIVE_CONNECT,
@@ -104,6 +106,7 @@ enum_long(OPT)
         
     // Blitter
     OPT_BLITTER_ACCURACY,
+    OPT_BLITTER_ASYNC,
     
     // CIAs
     OPT_CIA_REVISION,
@@ -156,6 +159,7 @@ struct OptionEnum : util::Reflection<OptionEnum, Option>
         switch (value) {
 
             case OPT_VIDEO_FORMAT:          return "VIDEO_FORMAT";
+            case OPT_ADAPTIVE_ACCURACY:     return "ADAPTIVE_ACCURACY";
 
             case OPT_AGNUS_REVISION:        return "AGNUS_REVISION";
             case OPT_SLOW_RAM_MIRROR:       return "SLOW_RAM_MIRROR";
@@ -191,6 +195,7 @@ struct OptionEnum : util::Reflection<OptionEnum, Option>
             case OPT_BANKMAP:               return "BANKMAP";
             case OPT_UNMAPPING_TYPE:        return "UNMAPPING_TYPE";
             case OPT_RAM_INIT_PATTERN:      return "RAM_INIT_PATTERN";
+            case OPT_MEM_STATS:             return "MEM_STATS";
                 
             case OPT_DRIVE_CONNECT:         return "DRIVE_CONNECT";
             case OPT_DRIVE_SPEED:           return "DRIVE_SPEED";
@@ -226,6 +231,7 @@ struct OptionEnum : util::Reflection<OptionEnum, Option>
             case OPT_CLX_PLF_PLF:           return "CLX_PLF_PLF";
                     
             case OPT_BLITTER_ACCURACY:      return "BLITTER_ACCURACY";
+            case OPT_BLITTER_ASYNC:         return "BLITTER_ASYNC";
                 
             case OPT_CIA_REVISION:          return "CIA_REVISION";
             case OPT_TODBUG:                return "TODBUG";
@@ -45,9 +45,9 @@
 enum class Category
 {    
     BankMap, Beam, Blocks, Breakpoints, Bus, Callstack, Catchpoints, Checksums,
-    Config, Defaults, Dma, Drive, Events, FileSystem, Geometry, Hunks, List1,
-    List2, Parameters, Partitions, Properties, Registers, Sections, Segments,
-    Signals, State, Stats, Summary, SwTraps, Tod, Volumes, Watchpoints
+    Config, Defaults, Dma, Drive, Events, FileSystem, Footprint, Geometry, Hunks,
+    List1, List2, Parameters, Partitions, Properties, Registers, Sections,
+    Segments, Signals, State, Stats, Summary, SwTraps, Tod, Volumes, Watchpoints
 };
 
 class AmigaObject {
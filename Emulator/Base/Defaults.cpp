@@ -30,6 +30,7 @@
 Defaults::Defaults()
 {
     setFallback(OPT_VIDEO_FORMAT, PAL);
+    setFallback(OPT_ADAPTIVE_ACCURACY, false);
     setFallback(OPT_AGNUS_REVISION, AGNUS_ECS_1MB);
     setFallback(OPT_SLOW_RAM_MIRROR, true);
     setFallback(OPT_PTR_DROPS, true);
@@ -71,6 +72,7 @@ Defaults::Defaults()
     setFallback(OPT_BANKMAP, BANK_MAP_A500);
     setFallback(OPT_UNMAPPING_TYPE, RAM_INIT_ALL_ZEROES);
     setFallback(OPT_RAM_INIT_PATTERN, UNMAPPED_FLOATING);
+    setFallback(OPT_MEM_STATS, true);
     setFallback(OPT_DRIVE_CONNECT, 0, true);
     setFallback(OPT_DRIVE_CONNECT, { 1, 2, 3 }, false);
     setFallback(OPT_DRIVE_SPEED, 1);
@@ -103,6 +105,7 @@ Defaults::Defaults()
     setFallback(OPT_CLX_SPR_PLF, false);
     setFallback(OPT_CLX_PLF_PLF, false);
     setFallback(OPT_BLITTER_ACCURACY, 2);
+    setFallback(OPT_BLITTER_ASYNC, false);
     setFallback(OPT_CIA_REVISION, CIA_MOS_8520_DIP);
     setFallback(OPT_TODBUG, true);
     setFallback(OPT_ECLOCK_SYNCING, true);
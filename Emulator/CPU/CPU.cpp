@@ -78,7 +78,12 @@ Moira::read16(u32 addr)
 u16
 Moira::read16Dasm(u32 addr)
 {
-    auto result = mem.spypeek16 <ACCESSOR_CPU> (addr);
+    CPU *cpu = (CPU *)this;
+
+    // When decoding a trace file, read from the recorded instruction words
+    auto offset = addr - cpu->dasmAddr;
+    auto result = cpu->dasmWords == nullptr ? mem.spypeek16 <ACCESSOR_CPU> (addr) :
+    offset < 10 ? cpu->dasmWords[offset / 2] : 0;
     
     // For LINE-A instructions, check if the opcode is a software trap
     if (Debugger::isLineAInstr(result)) result = debugger.swTraps.resolve(result);
@@ -159,6 +164,23 @@ Moira::didExecute(const char *func, Instr I, Mode M, Size S, u16 opcode)
     }
 }
 
+void
+Moira::traceInstruction()
+{
+    CPU *cpu = (CPU *)this;
+
+    u16 words[5] = {
+        
+        queue.ird,
+        queue.irc,
+        mem.spypeek16 <ACCESSOR_CPU> (reg.pc0 + 4),
+        mem.spypeek16 <ACCESSOR_CPU> (reg.pc0 + 6),
+        mem.spypeek16 <ACCESSOR_CPU> (reg.pc0 + 8)
+    };
+    
+    cpu->tracer.record(reg.pc0, words, clock, reg.r);
+}
+
 void
 Moira::willExecute(ExceptionType exc, u16 vector)
 {
@@ -378,6 +400,7 @@ CPU::setConfigItem(Option option, i64 value)
                 case CPU_68EC020:   setModel(moira::M68EC020); break;
                 case CPU_68EC030:   setModel(moira::M68EC030); break;
             }
+            clearDasmCache();
             resume();
             return;
 
@@ -397,6 +420,7 @@ CPU::setConfigItem(Option option, i64 value)
         case OPT_CPU_DASM_STYLE:
 
             setDasmStyle(moira::DasmStyle(value));
+            clearDasmCache();
             return;
 
         default:
@@ -446,6 +470,9 @@ CPU::_reset(bool hard)
         // Remove all previously recorded instructions
         debugger.clearLog();
         
+        // Keep tracing if a trace is running
+        if (tracer.isTracing()) flags |= CPU_TRACE_INSTRUCTION;
+        
     } else {
         
         /* "The RESET instruction causes the processor to assert RESET for 124
@@ -487,6 +514,12 @@ CPU::_inspect() const
     }
 }
 
+isize
+CPU::_memoryFootprint() const
+{
+    return isize(dasmCache.capacity() * sizeof(DasmCacheEntry)) + tracer.footprint();
+}
+
 void
 CPU::_dump(Category category, std::ostream& os) const
 {
@@ -507,7 +540,11 @@ CPU::_dump(Category category, std::ostream& os) const
         os << util::tab("Control flags");
         os << util::hex((u16)flags) << std::endl;
         os << util::tab("Last exception");
-        os << util::dec(exception);
+        os << util::dec(exception) << std::endl;
+        os << util::tab("Dasm cache hits");
+        os << util::dec(dasmCacheHits) << std::endl;
+        os << util::tab("Dasm cache misses");
+        os << util::dec(dasmCacheMisses);
     }
 
     if (category == Category::Registers) {
@@ -665,6 +702,13 @@ CPU::didLoadFromBuffer(const u8 *buffer)
      */
     debugger.breakpoints.setNeedsCheck(debugger.breakpoints.elements() != 0);
     debugger.watchpoints.setNeedsCheck(debugger.watchpoints.elements() != 0);
+    
+    // The same applies to the tracing flag
+    if (tracer.isTracing()) {
+        flags |= CPU_TRACE_INSTRUCTION;
+    } else {
+        flags &= ~CPU_TRACE_INSTRUCTION;
+    }
     return 0;
 }
 
@@ -713,10 +757,51 @@ CPU::disassembleInstr(u32 addr, isize *len)
 {
     static char result[128];
 
-    int l = disassemble(addr, result);
+    // Bypass the cache when decoding a trace file
+    if (dasmWords) {
+        
+        int l = disassemble(addr, result);
+        
+        if (len) *len = (isize)l;
+        return result;
+    }
+    
+    auto &entry = dasmCache[(addr >> 1) & (dasmCacheSize - 1)];
 
-    if (len) *len = (isize)l;
-    return result;
+    // Check for a cache hit
+    bool hit = entry.len && entry.addr == addr;
+
+    for (isize i = 0; hit && i < entry.len / 2; i++) {
+        hit = entry.words[i] == mem.spypeek16 <ACCESSOR_CPU> (u32(addr + 2 * i));
+    }
+
+    if (hit) {
+        
+        dasmCacheHits++;
+        if (len) *len = entry.len;
+        return entry.instr;
+    }
+
+    dasmCacheMisses++;
+
+    int l = disassemble(addr, entry.instr);
+
+    // Only cache instructions whose words fit into the entry
+    entry.addr = addr;
+    entry.len = l <= isize(sizeof(entry.words)) ? isize(l) : 0;
+
+    for (isize i = 0; i < entry.len / 2; i++) {
+        entry.words[i] = mem.spypeek16 <ACCESSOR_CPU> (u32(addr + 2 * i));
+    }
+
+    if (len) *len = isize(l);
+    return entry.instr;
+}
+
+void
+CPU::clearDasmCache()
+{
+    for (auto &entry : dasmCache) entry.len = 0;
 }
 
 const char *
@@ -749,6 +834,103 @@ CPU::disassembleWords(isize len)
     return disassembleWords(reg.pc0, len);
 }
 
+void
+CPU::startTracing(const string &path, bool regs)
+{
+    {   SUSPENDED
+        
+        tracer.start(path, u32(config.revision), regs);
+        flags |= CPU_TRACE_INSTRUCTION;
+    }
+}
+
+void
+CPU::stopTracing()
+{
+    {   SUSPENDED
+        
+        flags &= ~CPU_TRACE_INSTRUCTION;
+        tracer.stop();
+    }
+
+    if (tracer.hasFailed()) throw VAError(ERROR_FILE_CANT_WRITE, tracer.getPath());
+}
+
+void
+CPU::decodeTrace(const string &path, std::ostream& os)
+{
+    if (!isPoweredOff()) throw VAError(ERROR_POWERED_ON);
+
+    TraceHeader header;
+    bool first = true;
+    
+    /* Register values are recorded before an instruction is executed. Hence,
+     * the changes reported in a record are caused by the previous
+     * instruction. To print them next to the causing instruction, each line
+     * is completed when the next record comes in.
+     */
+    char line[256] = "Initial state:";
+    
+    auto appendRegs = [&](const TraceRecord &rec, const u32 *regs) {
+        
+        auto n = isize(strlen(line));
+        
+        for (isize i = 0; i < 16 && n < isize(sizeof(line)) - 16; i++) {
+            
+            if (rec.regMask & (1 << i)) {
+                
+                n += snprintf(line + n, sizeof(line) - n, " %c%ld=%08x",
+                              i < 8 ? 'D' : 'A', long(i & 7), regs[i]);
+            }
+        }
+    };
+    
+    InstrTracer::decode(path, header, [&](const TraceRecord &rec, const u32 *regs) {
+        
+        // Switch to the CPU revision the trace has been recorded with
+        if (first) {
+            
+            if (CPURevisionEnum::isValid(header.revision)) {
+                setConfigItem(OPT_CPU_REVISION, header.revision);
+            }
+        }
+        
+        /* Report dropped records. The register changes of the previous
+         * instruction are unknown. The next record reports all registers
+         * that differ from zero and completes the gap line.
+         */
+        if (rec.isGap()) {
+            
+            if (!first) os << line << '\n';
+            first = false;
+            
+            snprintf(line, sizeof(line), "%12s  %lld instructions dropped:",
+                     "", (long long)rec.cycle);
+            return;
+        }
+        
+        // Complete and print the previous line
+        if (header.regs) appendRegs(rec, regs);
+        if (!first || header.regs) os << line << '\n';
+        first = false;
+        
+        // Disassemble the instruction from the recorded instruction words
+        dasmWords = rec.words;
+        dasmAddr = rec.pc;
+        
+        isize len;
+        auto instr = disassembleInstr(rec.pc, &len);
+        auto words = disassembleWords(rec.pc, std::min(len / 2, isize(5)));
+        
+        dasmWords = nullptr;
+        
+        snprintf(line, sizeof(line), "%12lld  %s  %-24s %s",
+                 (long long)rec.cycle, disassembleAddr(rec.pc), words, instr);
+    });
+    
+    if (!first) os << line << '\n';
+}
+
 void
 CPU::jump(u32 addr)
 {
@@ -10,6 +10,7 @@
 #pragma once
 
 #include "CPUTypes.h"
+#include "InstrTracer.h"
 #include "SubComponent.h"
 #include "RingBuffer.h"
 #include "Moira.h"
@@ -29,6 +30,24 @@ class CPU : public moira::Moira {
     // Recorded call stack
     CallstackRecorder callstack;
 
+    // Instruction tracer
+    InstrTracer tracer;
+
+    // Instruction words used by the disassembler when decoding a trace file
+    const u16 *dasmWords = nullptr;
+    u32 dasmAddr = 0;
+
+    /* Disassembler cache. Debugger views disassemble the same instructions
+     * over and over again. To speed things up, disassembled instructions are
+     * stored in a direct-mapped cache. An entry is valid as long as all
+     * instruction words are still in memory. They are compared on lookup,
+     * which keeps the memory write path free of any bookkeeping.
+     */
+    static constexpr isize dasmCacheSize = 1024;
+    std::vector<DasmCacheEntry> dasmCache = std::vector<DasmCacheEntry>(dasmCacheSize);
+    i64 dasmCacheHits = 0;
+    i64 dasmCacheMisses = 0;
+
 
     //
     // Overclocking
@@ -70,6 +89,7 @@ private:
     
     void _reset(bool hard) override;
     void _inspect() const override;
+    isize _memoryFootprint() const override;
     void _debugOn() override;
     void _debugOff() override;
     
@@ -189,6 +209,9 @@ public:
 
     // Disassembles the instruction at the specified address
     const char *disassembleInstr(u32 addr, isize *len);
+    
+    // Removes all entries from the disassembler cache
+    void clearDasmCache();
     const char *disassembleWords(u32 addr, isize len);
     const char *disassembleAddr(u32 addr);
 
@@ -197,6 +220,22 @@ public:
     const char *disassembleWords(isize len);
     
     
+    //
+    // Tracing
+    //
+    
+    // Streams all executed instructions into a file
+    void startTracing(const string &path, bool regs = false) throws;
+    void stopTracing() throws;
+    bool isTracing() const { return tracer.isTracing(); }
+    
+    // Prints some statistics about the running trace
+    void dumpTrace(std::ostream& os) const { tracer.dump(os); }
+    
+    // Disassembles a trace file (requires the emulator to be powered off)
+    void decodeTrace(const string &path, std::ostream& os) throws;
+    
+    
     //
     // Changing state
     //
@@ -118,4 +118,19 @@ struct CallstackRecorder : public util::SortedRingBuffer<CallStackEntry, 64>
         worker >> this->elements << this->r << this->w << this->keys;
     }
 };
+
+struct DasmCacheEntry
+{
+    // Address of the cached instruction
+    u32 addr;
+
+    // Length of the instruction in bytes (0 = entry is empty)
+    isize len;
+
+    // All instruction words (an instruction is at most 11 words long)
+    u16 words[11];
+
+    // The disassembled instruction
+    char instr[128];
+};
 #endif
@@ -0,0 +1,219 @@
+// -----------------------------------------------------------------------------
+// This file is part of vAmiga
+//
+// Copyright (C) Dirk W. Hoffmann. www.dirkwhoffmann.de
+// Licensed under the GNU General Public License v3
+//
+// See https://www.gnu.org for license information
+// -----------------------------------------------------------------------------
+
+#include "config.h"
+#include "InstrTracer.h"
+#include "Error.h"
+#include "IOUtils.h"
+
+InstrTracer::~InstrTracer()
+{
+    stop();
+}
+
+void
+InstrTracer::start(const string &path, u32 revision, bool regs)
+{
+    stop();
+
+    stream.open(path, std::ios::binary | std::ios::trunc);
+    if (!stream.is_open()) throw VAError(ERROR_FILE_CANT_CREATE, path);
+    this->path = path;
+
+    // Write the file header
+    TraceHeader header = { { 'V', 'A', 'T', 'R', 'A', 'C', 'E', 0 } };
+    header.version = version;
+    header.revision = revision;
+    header.regs = regs;
+    stream.write((const char *)&header, sizeof(header));
+
+    // Prepare the first chunk
+    chunk.data.resize(chunkSize);
+    chunk.used = chunk.count = 0;
+
+    // Clear the register cache and the statistics
+    std::memset(prevRegs, 0, sizeof(prevRegs));
+    records = dropped = written = gap = 0;
+    failed = !stream;
+
+    traceRegs = regs;
+    tracing = true;
+    quit = false;
+
+    // Launch the writer thread
+    writer = std::thread(&InstrTracer::writeLoop, this);
+}
+
+void
+InstrTracer::stop()
+{
+    if (!tracing) return;
+
+    // Hand over the last chunk (wait for the writer instead of dropping it)
+    flush(true);
+
+    // Terminate the writer thread
+    {   std::lock_guard<std::mutex> lock(mutex);
+        quit = true;
+    }
+    cond.notify_one();
+    writer.join();
+
+    stream.close();
+    if (!stream) failed = true;
+
+    pool.clear();
+    chunk = TraceChunk { };
+    tracing = false;
+}
+
+void
+InstrTracer::flush(bool wait)
+{
+    {   std::unique_lock<std::mutex> lock(mutex);
+
+        if (isize(pending.size()) >= maxPending) {
+
+            if (wait) {
+
+                // Block until the writer has made room
+                room.wait(lock, [this]() { return isize(pending.size()) < maxPending; });
+
+            } else {
+
+                // The writer is too slow. Discard the chunk to keep going
+                dropped += chunk.count;
+                gap += chunk.count;
+
+                /* Start the chunk with a gap record. If a gap record has been
+                 * discarded along with the chunk, the new one includes its
+                 * count. The next record carries all non-zero registers.
+                 */
+                TraceRecord rec = { TraceRecord::gap, { }, 0, gap };
+                std::memcpy(chunk.data.data(), &rec, sizeof(rec));
+                chunk.used = sizeof(rec);
+                chunk.count = 0;
+                std::memset(prevRegs, 0, sizeof(prevRegs));
+                return;
+            }
+        }
+
+        records += chunk.count;
+        pending.push_back(std::move(chunk));
+        gap = 0;
+
+        // Grab a new chunk (preferably one that has been used before)
+        if (pool.empty()) {
+            chunk = TraceChunk { };
+        } else {
+            chunk = std::move(pool.back());
+            pool.pop_back();
+        }
+    }
+    cond.notify_one();
+
+    chunk.data.resize(chunkSize);
+    chunk.used = chunk.count = 0;
+}
+
+void
+InstrTracer::writeLoop()
+{
+    std::unique_lock<std::mutex> lock(mutex);
+
+    while (true) {
+
+        cond.wait(lock, [this]() { return quit || !pending.empty(); });
+
+        if (pending.empty()) break;
+
+        auto next = std::move(pending.front());
+        pending.pop_front();
+
+        // Write the chunk without blocking the emulator thread
+        auto skip = failed;
+        lock.unlock();
+        room.notify_one();
+        if (!skip) stream.write((const char *)next.data.data(), next.used);
+        auto ok = !skip && stream.good();
+        lock.lock();
+
+        // Once a write has failed, all remaining chunks are discarded
+        if (ok) {
+            written += next.used;
+        } else {
+            failed = true;
+        }
+        pool.push_back(std::move(next));
+    }
+}
+
+void
+InstrTracer::dump(std::ostream& os) const
+{
+    using namespace util;
+
+    std::lock_guard<std::mutex> lock(mutex);
+
+    os << tab("Tracing");
+    os << bol(tracing) << std::endl;
+    os << tab("Registers");
+    os << bol(traceRegs) << std::endl;
+    os << tab("Recorded instructions");
+    os << dec(records + chunk.count) << std::endl;
+    os << tab("Dropped instructions");
+    os << dec(dropped) << std::endl;
+    os << tab("Written bytes");
+    os << dec(written) << std::endl;
+    os << tab("Write error");
+    os << bol(failed) << std::endl;
+}
+
+isize
+InstrTracer::footprint() const
+{
+    std::lock_guard<std::mutex> lock(mutex);
+
+    auto result = chunk.data.capacity();
+    for (auto &c : pending) result += c.data.capacity();
+    for (auto &c : pool) result += c.data.capacity();
+
+    return isize(result);
+}
+
+void
+InstrTracer::decode(const string &path, TraceHeader &header,
+                    std::function<void(const TraceRecord &, const u32 *)> func)
+{
+    std::ifstream stream(path, std::ios::binary);
+    if (!stream.is_open()) throw VAError(ERROR_FILE_NOT_FOUND, path);
+
+    // Read and check the header
+    stream.read((char *)&header, sizeof(header));
+    if (!stream || std::memcmp(header.magic, "VATRACE", 8) != 0 || header.version != version) {
+        throw VAError(ERROR_FILE_TYPE_MISMATCH, path);
+    }
+
+    TraceRecord rec;
+    u32 regs[16] = { };
+
+    while (stream.read((char *)&rec, sizeof(rec))) {
+
+        // The register values are unknown after a gap
+        if (rec.isGap()) std::memset(regs, 0, sizeof(regs));
+
+        // Apply the register deltas
+        for (isize i = 0; i < 16; i++) {
+            if (rec.regMask & (1 << i)) stream.read((char *)&regs[i], sizeof(u32));
+        }
+        if (!stream) break;
+
+        func(rec, regs);
+    }
+}
@@ -0,0 +1,273 @@
+// -----------------------------------------------------------------------------
+// This file is part of vAmiga
+//
+// Copyright (C) Dirk W. Hoffmann. www.dirkwhoffmann.de
+// Licensed under the GNU General Public License v3
+//
+// See https://www.gnu.org for license information
+// -----------------------------------------------------------------------------
+
+#pragma once
+
+#include "Types.h"
+#include "Exception.h"
+#include <condition_variable>
+#include <deque>
+#include <fstream>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/* The instruction tracer streams a binary record for each executed
+ * instruction into a file. In contrast to the log buffer of the CPU debugger,
+ * which only keeps the most recent instructions, the tracer records the
+ * complete execution history and is meant for offline analysis, e.g., for
+ * comparing the instruction streams of two emulator builds.
+ *
+ * Records are collected in large chunks by the emulator thread. Full chunks
+ * are handed over to a background thread which writes them to disk. Hence,
+ * the emulator thread never waits for the file system. If the writer falls
+ * behind by more than maxPending chunks, records are dropped and counted.
+ * In place of the dropped records, a gap record is stored. When tracing is
+ * stopped, the last chunk is never dropped. stop() waits for the writer
+ * instead. If a write fails, all subsequent chunks are discarded and the
+ * failure is reported by hasFailed().
+ *
+ * File layout:
+ *
+ *     TraceHeader
+ *     TraceRecord [u32 ...]
+ *     TraceRecord [u32 ...]
+ *     ...
+ *
+ * If register tracing is enabled, each record is followed by the values of
+ * all data and address registers that have changed since the previous
+ * record. The changed registers are flagged in TraceRecord::regMask (bit 0
+ * represents D0, bit 15 represents A7).
+ *
+ * A gap record is marked by TraceRecord::gap in the pc field. Its cycle field
+ * holds the number of dropped records. After a gap, the register values are
+ * unknown. Hence, the register cache is cleared, just like at the beginning
+ * of the file, and the next record is compared against all zeroes.
+ */
+
+struct TraceHeader
+{
+    // Magic bytes ("VATRACE")
+    char magic[8];
+
+    // Version of the file format
+    u32 version;
+
+    // The emulated CPU revision (CPURevision)
+    u32 revision;
+
+    // Indicates if register deltas are recorded
+    u32 regs;
+
+    // Currently unused
+    u32 reserved;
+};
+
+struct TraceRecord
+{
+    // Value of the pc field in a gap record
+    static constexpr u32 gap = 0xFFFFFFFF;
+
+    // Address of the instruction
+    u32 pc;
+
+    // Opcode and extension words
+    u16 words[5];
+
+    // Registers that have changed since the last record
+    u16 regMask;
+
+    // CPU clock when the instruction starts
+    i64 cycle;
+
+    // Checks if this record stands for dropped records
+    bool isGap() const { return pc == gap; }
+};
+
+static_assert(sizeof(TraceHeader) == 24);
+static_assert(sizeof(TraceRecord) == 24);
+
+struct TraceChunk
+{
+    // Record storage
+    std::vector<u8> data;
+
+    // Number of used bytes
+    isize used = 0;
+
+    // Number of stored records
+    isize count = 0;
+};
+
+class InstrTracer {
+
+public:
+
+    // File format version
+    static constexpr u32 version = 2;
+
+    // Maximum number of bytes produced per instruction
+    static constexpr isize maxRecordSize = sizeof(TraceRecord) + 16 * 4;
+
+    // Size of a single chunk
+    static constexpr isize chunkSize = 1024 * 1024;
+
+    // Maximum number of chunks waiting to be written
+    static constexpr isize maxPending = 64;
+
+private:
+
+    // The output file
+    std::ofstream stream;
+    string path;
+
+    // The writer thread
+    std::thread writer;
+
+    // Chunks waiting to be written and chunks available for reuse
+    std::deque <TraceChunk> pending;
+    std::vector <TraceChunk> pool;
+
+    // Synchronization primitives for the writer thread
+    mutable std::mutex mutex;
+    std::condition_variable cond;
+
+    // Signals the emulator thread that a pending chunk has been taken
+    std::condition_variable room;
+
+    // The chunk currently filled by the emulator thread
+    TraceChunk chunk;
+
+    // Indicates if the tracer is running
+    bool tracing = false;
+
+    // Indicates if the writer thread should terminate
+    bool quit = false;
+
+    // Indicates if register deltas are recorded
+    bool traceRegs = false;
+
+    // Indicates if writing to the output file has failed
+    bool failed = false;
+
+    // Register values of the previous record
+    u32 prevRegs[16] = { };
+
+    // Number of records dropped since the latest gap record has been queued
+    i64 gap = 0;
+
+    // Statistics
+    i64 records = 0;
+    i64 dropped = 0;
+    i64 written = 0;
+
+
+    //
+    // Initializing
+    //
+
+public:
+
+    ~InstrTracer();
+
+
+    //
+    // Controlling
+    //
+
+public:
+
+    // Starts tracing into the specified file
+    void start(const string &path, u32 revision, bool regs) throws;
+
+    // Flushes all pending records and stops tracing
+    void stop();
+
+    // Returns true if the tracer is running
+    bool isTracing() const { return tracing; }
+
+    // Returns the path of the current or latest trace file
+    const string &getPath() const { return path; }
+
+    // Returns true if the trace file could not be written completely
+    bool hasFailed() const { std::lock_guard<std::mutex> lock(mutex); return failed; }
+
+    // Prints some statistics
+    void dump(std::ostream& os) const;
+
+    // Returns the number of bytes allocated for the record chunks
+    isize footprint() const;
+
+
+    //
+    // Recording
+    //
+
+public:
+
+    // Records a single instruction
+    void record(u32 pc, const u16 *words, i64 cycle, const u32 *regs) {
+
+        if (chunk.used + maxRecordSize > chunkSize) flush();
+
+        TraceRecord rec;
+        u32 values[16];
+        isize cnt = 0;
+
+        rec.pc = pc;
+        for (isize i = 0; i < 5; i++) rec.words[i] = words[i];
+        rec.regMask = 0;
+        rec.cycle = cycle;
+
+        if (traceRegs) {
+
+            for (isize i = 0; i < 16; i++) {
+
+                if (regs[i] != prevRegs[i]) {
+
+                    rec.regMask |= u16(1 << i);
+                    values[cnt++] = prevRegs[i] = regs[i];
+                }
+            }
+        }
+
+        auto *dst = chunk.data.data() + chunk.used;
+        std::memcpy(dst, &rec, sizeof(rec));
+        std::memcpy(dst + sizeof(rec), values, cnt * sizeof(u32));
+        chunk.used += sizeof(rec) + cnt * sizeof(u32);
+        chunk.count++;
+    }
+
+private:
+
+    /* Hands the current chunk over to the writer thread. If the writer has
+     * fallen behind, the chunk is either dropped or the function blocks until
+     * the writer has caught up.
+     */
+    void flush(bool wait = false);
+
+    // Main function of the writer thread
+    void writeLoop();
+
+
+    //
+    // Decoding
+    //
+
+public:
+
+    /* Reads a trace file and passes each record to the provided function. The
+     * function is called with the record and a pointer to the 16 register
+     * values as they have been at the time the record was taken. Gap records
+     * are passed, too. They reset all register values to zero.
+     */
+    static void decode(const string &path, TraceHeader &header,
+                       std::function<void(const TraceRecord &, const u32 *)> func) throws;
+};
@@ -14,6 +14,8 @@
 #include <algorithm>
 #include <cmath>
 #include <bit>
+#include <memory>
+#include <mutex>
 #include <vector>
 
 namespace moira {
@@ -29,18 +31,9 @@ namespace moira {
 
 Moira::Moira(Amiga &ref) : SubComponent(ref)
 {
-    if (BUILD_INSTR_INFO_TABLE) info = new InstrInfo[65536];
-    if (ENABLE_DASM) dasm = new DasmPtr[65536];
-    
     createJumpTable();
 }
 
-Moira::~Moira()
-{
-    if (info) delete [] info;
-    if (dasm) delete [] dasm;
-}
-
 void
 Moira::setModel(Model model)
 {
@@ -175,11 +168,14 @@ Moira::execute()
     // The quick execution path: Call the instruction handler and return
     //
     
-    if (!flags) {
+    if (!(flags & ~CPU_CHECK_GUARDS)) {
         
         reg.pc += 2;
         (this->*exec[queue.ird])(queue.ird);
         assert(reg.pc0 == reg.pc);
+        
+        // Watchpoints and catchpoints are checked elsewhere
+        if (flags & CPU_CHECK_BP) goto done;
         return;
     }
     
@@ -231,6 +227,11 @@ Moira::execute()
         debugger.logInstruction();
     }
     
+    // If tracing is enabled, pass the instruction to the tracer
+    if (flags & CPU_TRACE_INSTRUCTION) {
+        traceInstruction();
+    }
+    
     // Execute the instruction
     if (flags & CPU_IS_LOOPING) {
         
@@ -92,6 +92,14 @@ protected:
      *
      * CPU_CHECK_WP:
      *    This flag indicates whether the CPU should check fo watchpoints.
+     *
+     * CPU_CHECK_CP:
+     *    This flag indicates whether the CPU should check for catchpoints.
+     *    The three guard flags keep the CPU on the quick execution path.
+     *
+     * CPU_TRACE_INSTRUCTION:
+     *    If this flag is set, the CPU passes each instruction to the
+     *    traceInstruction() delegate before executing it.
      */
     int flags;
     static constexpr int CPU_IS_HALTED          = (1 << 8);
@@ -104,6 +112,8 @@ protected:
     static constexpr int CPU_CHECK_BP           = (1 << 15);
     static constexpr int CPU_CHECK_WP           = (1 << 16);
     static constexpr int CPU_CHECK_CP           = (1 << 17);
+    static constexpr int CPU_TRACE_INSTRUCTION  = (1 << 18);
+    static constexpr int CPU_CHECK_GUARDS       = CPU_CHECK_BP | CPU_CHECK_WP | CPU_CHECK_CP;
     
     // Number of elapsed cycles since powerup
     i64 clock;
@@ -131,10 +141,10 @@ protected:
     
     // Jump table holding the instruction handlers
     typedef void (Moira::*ExecPtr)(u16);
-    ExecPtr exec[65536];
+    ExecPtr *exec = nullptr;
     
     // Jump table holding the instruction handlers for the 68010 loop mode
-    ExecPtr loop[65536];
+    ExecPtr *loop = nullptr;
     
     // Jump table holding the disassebler handlers
     typedef void (Moira::*DasmPtr)(StrWriter&, u32&, u16);
@@ -145,6 +155,13 @@ private:
     // Table holding instruction infos
     InstrInfo *info = nullptr;
     
+    /* The jump tables only depend on the emulated CPU model. They are built
+     * once per model when the model is selected for the first time and are
+     * shared by all instances afterwards. The pointers above refer to the
+     * tables of the currently selected model.
+     */
+    struct JumpTables;
+    
     
     //
     // Constructing
@@ -153,7 +170,7 @@ private:
 public:
     
     Moira(Amiga &ref);
-    virtual ~Moira();
+    virtual ~Moira() = default;
     
     // Selects the emulated CPU model
     void setModel(Model model);
@@ -166,13 +183,18 @@ public:
     
 protected:
     
-    // Creates the generic jump table
+    // Selects the jump tables for the current model (builds them if needed)
     void createJumpTable();
     
 private:
     
     template <Core C> void createJumpTable();
 
+public:
+
+    // Returns the number of bytes allocated for the shared jump tables
+    static i64 jumpTableFootprint();
+
 
     //
     // Querying CPU properties
@@ -269,6 +291,7 @@ protected:
     // Instruction delegates
     void willExecute(const char *func, Instr I, Mode M, Size S, u16 opcode);
     void didExecute(const char *func, Instr I, Mode M, Size S, u16 opcode);
+    void traceInstruction();
     
     // Exception delegates
     void willExecute(ExceptionType exc, u16 vector);
@@ -51,11 +51,8 @@ Guards::guardNr(long nr)const
 Guard *
 Guards::guardAt(u32 addr) const
 {
-    for (int i = 0; i < count; i++) {
-        if (guards[i].addr == addr) return &guards[i];
-    }
-    
-    return nullptr;
+    auto it = addrMap.find(addr);
+    return it != addrMap.end() ? it->second : nullptr;
 }
 
 std::optional<u32>
@@ -80,6 +77,7 @@ Guards::setAt(u32 addr)
     }
     
     guards[count++].addr = addr;
+    updateIndex();
     setNeedsCheck(true);
 }
 
@@ -101,6 +99,7 @@ Guards::removeAt(u32 addr)
             break;
         }
     }
+    updateIndex();
     setNeedsCheck(count != 0);
 }
 
@@ -110,6 +109,21 @@ Guards::replace(long nr, u32 addr)
     if (nr >= count || isSetAt(addr)) return;
     
     guards[nr].addr = addr;
+    updateIndex();
+}
+
+void
+Guards::updateIndex()
+{
+    std::memset(pageMap, 0, sizeof(pageMap));
+    addrMap.clear();
+    
+    for (int i = 0; i < count; i++) {
+        
+        auto page = (guards[i].addr >> pageShift) & (pageCount - 1);
+        pageMap[page >> 6] |= u64(1) << (page & 63);
+        addrMap[guards[i].addr] = &guards[i];
+    }
 }
 
 bool
@@ -164,12 +178,21 @@ Guards::ignore(long nr, long count)
 bool
 Guards::eval(u32 addr, Size S)
 {
-    for (int i = 0; i < count; i++) {
+    auto last = addr + u32(S) - 1;
+    
+    // Reject the access if no guard is set on the touched page(s)
+    if (!pageHasGuard(addr) && !pageHasGuard(last)) return false;
+    
+    // Check all guarded addresses in the accessed range
+    for (u32 a = addr; a <= last; a++) {
         
-        if (guards[i].eval(addr, S)) {
-            
-            hit = guards[i];
-            return true;
+        if (auto it = addrMap.find(a); it != addrMap.end()) {
+
+            if (auto guard = it->second; guard->eval(addr, S)) {
+
+                hit = *guard;
+                return true;
+            }
         }
     }
     return false;
@@ -267,24 +290,6 @@ Debugger::softstopMatches(u32 addr)
     return false;
 }
 
-bool
-Debugger::breakpointMatches(u32 addr)
-{
-    return breakpoints.eval(addr);
-}
-
-bool
-Debugger::watchpointMatches(u32 addr, Size S)
-{
-    return watchpoints.eval(addr, S);
-}
-
-bool
-Debugger::catchpointMatches(u32 vectorNr)
-{
-    return catchpoints.eval(vectorNr);
-}
-
 void
 Debugger::enableLogging()
 {
@@ -12,6 +12,7 @@
 #include "MoiraTypes.h"
 #include "StrWriter.h"
 #include <map>
+#include <unordered_map>
 
 namespace moira {
 
@@ -57,6 +58,17 @@ protected:
     // Number of currently stored guards
     long count = 0;
     
+    /* Lookup index. To speed up guard evaluation, all guard addresses are
+     * stored in a hash map pointing to the corresponding array element. In
+     * addition, a bitmap records which 4 KB pages contain at least one guard.
+     * Accesses to all other pages are rejected without consulting the hash
+     * map. The index is rebuilt whenever the guard array changes.
+     */
+    static constexpr int pageShift = 12;
+    static constexpr int pageCount = 1 << (24 - pageShift);
+    u64 pageMap[pageCount / 64] = { };
+    std::unordered_map<u32, Guard *> addrMap;
+    
 public:
     
     // A copy of the latest match
@@ -95,10 +107,22 @@ public:
     
     void remove(long nr);
     void removeAt(u32 addr);
-    void removeAll() { count = 0; setNeedsCheck(false); }
+    void removeAll() { count = 0; updateIndex(); setNeedsCheck(false); }
     
     void replace(long nr, u32 addr);
     
+private:
+    
+    // Rebuilds the lookup index
+    void updateIndex();
+    
+    // Checks if the page containing the specified address has a guard
+    bool pageHasGuard(u32 addr) const {
+        auto page = (addr >> pageShift) & (pageCount - 1);
+        return (pageMap[page >> 6] >> (page & 63)) & 1;
+    }
+    
+public:
     
     //
     // Enabling or disabling guards
@@ -126,6 +150,13 @@ public:
     // Indicates if guard checking is necessary
     virtual void setNeedsCheck(bool value) = 0;
     
+    /* Checks if an access touches a page with a guard. The CPU performs this
+     * check inline and only calls eval() if it succeeds.
+     */
+    bool mayMatch(u32 addr, Size S = Byte) const {
+        return pageHasGuard(addr) || pageHasGuard(addr + u32(S) - 1);
+    }
+    
     // Evaluates all guards
     bool eval(u32 addr, Size S = Byte);
 };
@@ -255,9 +286,15 @@ public:
     
     // Checks whether a debug events should be triggered
     bool softstopMatches(u32 addr);
-    bool breakpointMatches(u32 addr);
-    bool watchpointMatches(u32 addr, Size S);
-    bool catchpointMatches(u32 vectorNr);
+    bool breakpointMatches(u32 addr) {
+        return breakpoints.mayMatch(addr) && breakpoints.eval(addr);
+    }
+    bool watchpointMatches(u32 addr, Size S) {
+        return watchpoints.mayMatch(addr, S) && watchpoints.eval(addr, S);
+    }
+    bool catchpointMatches(u32 vectorNr) {
+        return catchpoints.mayMatch(vectorNr) && catchpoints.eval(vectorNr);
+    }
     
     
     //
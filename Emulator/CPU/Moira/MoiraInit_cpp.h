@@ -141,21 +141,74 @@ parse(const char *s, int sum = 0)
     *s == '1' ? parse(s + 1, (sum << 1) + 1) : (u16)sum;
 }
 
+struct Moira::JumpTables {
+    
+    ExecPtr exec[65536];
+    ExecPtr loop[65536];
+    DasmPtr dasm[ENABLE_DASM ? 65536 : 1];
+    InstrInfo info[BUILD_INSTR_INFO_TABLE ? 65536 : 1];
+};
+
+/* The shared jump tables. The tables of a model are allocated when the model
+ * is selected for the first time (about 3 MB per model with the
+ * disassembler and the instruction info table enabled). They are never
+ * released, not even when the last Moira instance is deleted, and stay
+ * allocated until the process terminates.
+ */
+
+// Protects the shared jump tables
+static std::mutex jumpTableMutex;
+
+// Number of bytes allocated for the shared jump tables
+static i64 jumpTableBytes = 0;
+
 void
 Moira::createJumpTable()
 {
-    switch (model) {
-
-        case M68000:    createJumpTable<C68000>(); break;
-        case M68010:    createJumpTable<C68010>(); break;
-        case M68EC020:
-        case M68020:
-        case M68EC030:
-        case M68030:    createJumpTable<C68020>(); break;
-
-        default:
-            fatalError;
+    static std::unique_ptr<JumpTables> tables[M68030 + 1];
+    
+    std::lock_guard<std::mutex> lock(jumpTableMutex);
+    
+    assert(model >= M68000 && model <= M68030);
+    auto &table = tables[model];
+    
+    // Build the tables if this model is selected for the first time
+    if (!table) {
+        
+        table = std::make_unique<JumpTables>();
+        jumpTableBytes += sizeof(JumpTables);
+        
+        exec = table->exec;
+        loop = table->loop;
+        dasm = ENABLE_DASM ? table->dasm : nullptr;
+        info = BUILD_INSTR_INFO_TABLE ? table->info : nullptr;
+        
+        switch (model) {
+                
+            case M68000:    createJumpTable<C68000>(); break;
+            case M68010:    createJumpTable<C68010>(); break;
+            case M68EC020:
+            case M68020:
+            case M68EC030:
+            case M68030:    createJumpTable<C68020>(); break;
+                
+            default:
+                fatalError;
+        }
     }
+    
+    // Switch to the tables of the selected model
+    exec = table->exec;
+    loop = table->loop;
+    dasm = ENABLE_DASM ? table->dasm : nullptr;
+    info = BUILD_INSTR_INFO_TABLE ? table->info : nullptr;
+}
+
+i64
+Moira::jumpTableFootprint()
+{
+    std::lock_guard<std::mutex> lock(jumpTableMutex);
+    return jumpTableBytes;
 }
 
 template <Core C> void
@@ -1177,7 +1177,20 @@ void
 Denise::vsyncHandler()
 {
     hflop = true;
-    pixelEngine.vsyncHandler();
+
+    if (reducedDrawing) {
+
+        // Keep the latest completely drawn frame in the stable buffer
+        pixelEngine.getWorkingBuffer().longFrame = agnus.pos.lof;
+
+    } else {
+
+        pixelEngine.vsyncHandler();
+    }
+
+    // In reduced accuracy mode, only draw every 8th frame completely
+    reducedDrawing = amiga.inReducedAccuracyMode() && (agnus.pos.frame & 7);
+
     debugger.vsyncHandler();
 }
 
@@ -1203,15 +1216,23 @@ Denise::hsyncHandler(isize vpos)
         // Perform playfield-playfield collision check (if enabled)
         if (config.clxPlfPlf) checkP2PCollisions();
 
-        // Draw border pixels
-        drawBorder();
+        if (reducedDrawing) {
+
+            // Only apply the color register changes
+            pixelEngine.endOfVBlankLine();
+
+        } else {
+
+            // Draw border pixels
+            drawBorder();
 
-        // Synthesize RGBA values and write the result into the frame buffer
-        pixelEngine.colorize(vpos);
+            // Synthesize RGBA values and write the result into the frame buffer
+            pixelEngine.colorize(vpos);
 
-        // Remove certain graphics layers if requested
-        if (config.hiddenLayers) {
-            pixelEngine.hide(vpos, config.hiddenLayers, config.hiddenLayerAlpha);
+            // Remove certain graphics layers if requested
+            if (config.hiddenLayers) {
+                pixelEngine.hide(vpos, config.hiddenLayers, config.hiddenLayerAlpha);
+            }
         }
         
     } else {
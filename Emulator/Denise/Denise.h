@@ -210,6 +210,14 @@ public:
     Pixel spriteClipBegin;
     Pixel spriteClipEnd;
 
+    /* Indicates if the current frame is drawn with reduced effort. In this
+     * mode, Denise still performs all steps needed for collision detection,
+     * but skips the border and the colorization stage. The frame buffers are
+     * not swapped at the end of such a frame. Hence, the stable buffer keeps
+     * the latest frame that has been drawn completely.
+     */
+    bool reducedDrawing = false;
+
  
     //
     // Rasterline data
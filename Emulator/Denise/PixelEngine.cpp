@@ -61,6 +61,12 @@ PixelEngine::_reset(bool hard)
     updateRGBA();
 }
 
+isize
+PixelEngine::_memoryFootprint() const
+{
+    return emuTexture[0].pixels.bytesize() + emuTexture[1].pixels.bytesize();
+}
+
 isize
 PixelEngine::didLoadFromBuffer(const u8 *buffer)
 {
@@ -113,6 +113,7 @@ private:
     
     void _initialize() override;
     void _reset(bool hard) override;
+    isize _memoryFootprint() const override;
 
     
     //
@@ -35,6 +35,12 @@ Recorder::_reset(bool hard)
     if (hard) audioClock = 0;
 }
 
+isize
+Recorder::_memoryFootprint() const
+{
+    return videoData.bytesize() + audioData.bytesize();
+}
+
 void
 Recorder::_dump(Category category, std::ostream& os) const
 {
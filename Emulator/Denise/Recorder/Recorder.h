@@ -105,6 +105,7 @@ private:
 
     void _initialize() override;
     void _reset(bool hard) override;
+    isize _memoryFootprint() const override;
 
     template <class T>
     void applyToPersistentItems(T& worker) { }
@@ -11,6 +11,7 @@
 #include "config.h"
 #include "Headless.h"
 #include "Script.h"
+#include "Parser.h"
 
 #ifndef _WIN32
 #include <getopt.h>
@@ -25,10 +26,22 @@ int main(int argc, char *argv[])
     } catch (SyntaxError &e) {
         
         std::cout << "Usage: ";
-        std::cout << "vAmigaCore [-vm] <script>" << std::endl;
+        std::cout << "vAmigaCore [-vmf] <script>" << std::endl;
+        std::cout << "       vAmigaCore -t <trace file>" << std::endl;
+        std::cout << "       vAmigaCore -b <blit trace file>" << std::endl;
+        std::cout << "       vAmigaCore -p <benchmark> [<rom> [<ext rom>]]" << std::endl;
+        std::cout << "       vAmigaCore -l <frame> [-o <file>] <rom> [<ext rom>]" << std::endl;
+        std::cout << "       vAmigaCore -s <component>" << std::endl;
         std::cout << std::endl;
         std::cout << "       -v or --verbose   Print executed script lines" << std::endl;
         std::cout << "       -m or --messages  Observe the message queue" << std::endl;
+        std::cout << "       -t or --trace     Disassemble an instruction trace" << std::endl;
+        std::cout << "       -b or --blits     Replay a blit trace" << std::endl;
+        std::cout << "       -f or --footprint Print the memory footprint on exit" << std::endl;
+        std::cout << "       -p or --perf      Run a benchmark (guards, instances, blitter, memory)" << std::endl;
+        std::cout << "       -l or --timeline  Record the DMA timeline of a frame" << std::endl;
+        std::cout << "       -o or --output    Save the timeline (.ppm for an image)" << std::endl;
+        std::cout << "       -s or --selftest  Run a self test (blitter, copper)" << std::endl;
         std::cout << std::endl;
         
         if (auto what = string(e.what()); !what.empty()) {
@@ -66,6 +79,41 @@ Headless::main(int argc, char *argv[])
     // Parse all command line arguments
     parseArguments(argc, argv);
 
+    // Decode an instruction trace if requested
+    if (keys.find("trace") != keys.end()) {
+
+        amiga.cpu.decodeTrace(keys["trace"], std::cout);
+        return;
+    }
+
+    // Replay a blit trace if requested
+    if (keys.find("blits") != keys.end()) {
+
+        amiga.agnus.blitter.replayTrace(keys["blits"], std::cout);
+        return;
+    }
+
+    // Run a benchmark if requested
+    if (keys.find("perf") != keys.end()) {
+
+        runBenchmark(keys["perf"]);
+        return;
+    }
+
+    // Run a self test if requested
+    if (keys.find("selftest") != keys.end()) {
+
+        runSelfTest(keys["selftest"]);
+        return;
+    }
+
+    // Record a DMA timeline if requested
+    if (keys.find("timeline") != keys.end()) {
+
+        recordTimeline(util::parseNum(keys["timeline"]));
+        return;
+    }
+
     // Redirect shell output to the console in verbose mode
     if (keys.find("verbose") != keys.end()) amiga.retroShell.setStream(std::cout);
 
@@ -84,6 +132,14 @@ Headless::main(int argc, char *argv[])
         barrier.lock();
         amiga.retroShell.continueScript();
     }
+
+    // Report the memory usage if requested
+    if (keys.find("footprint") != keys.end()) {
+
+        amiga.suspend();
+        amiga.dump(Category::Footprint);
+        amiga.resume();
+    }
 }
 
 #ifdef _WIN32
@@ -103,6 +159,13 @@ Headless::parseArguments(int argc, char *argv[])
         
         { "verbose",    no_argument,    NULL,   'v' },
         { "messages",   no_argument,    NULL,   'm' },
+        { "trace",      required_argument, NULL, 't' },
+        { "blits",      required_argument, NULL, 'b' },
+        { "footprint",  no_argument,    NULL,   'f' },
+        { "perf",       required_argument, NULL, 'p' },
+        { "timeline",   required_argument, NULL, 'l' },
+        { "output",     required_argument, NULL, 'o' },
+        { "selftest",   required_argument, NULL, 's' },
         { NULL,         0,              NULL,    0  }
     };
     
@@ -115,7 +178,7 @@ Headless::parseArguments(int argc, char *argv[])
     // Parse all options
     while (1) {
         
-        int arg = getopt_long(argc, argv, ":vm", long_options, NULL);
+        int arg = getopt_long(argc, argv, ":vmt:b:fp:l:o:s:", long_options, NULL);
         if (arg == -1) break;
 
         switch (arg) {
@@ -128,6 +191,34 @@ Headless::parseArguments(int argc, char *argv[])
                 keys["messages"] = "1";
                 break;
 
+            case 't':
+                keys["trace"] = util::makeAbsolutePath(optarg);
+                break;
+
+            case 'b':
+                keys["blits"] = util::makeAbsolutePath(optarg);
+                break;
+
+            case 'f':
+                keys["footprint"] = "1";
+                break;
+
+            case 'p':
+                keys["perf"] = optarg;
+                break;
+
+            case 'l':
+                keys["timeline"] = optarg;
+                break;
+
+            case 'o':
+                keys["output"] = util::makeAbsolutePath(optarg);
+                break;
+
+            case 's':
+                keys["selftest"] = optarg;
+                break;
+
             case ':':
                 throw SyntaxError("Missing argument for option '" +
                                   string(argv[optind - 1]) + "'");
@@ -152,6 +243,59 @@ Headless::parseArguments(int argc, char *argv[])
 void
 Headless::checkArguments()
 {
+    // A trace file is decoded without running a script
+    if (keys.find("trace") != keys.end()) {
+
+        if (!util::fileExists(keys["trace"])) {
+            throw SyntaxError("File " + keys["trace"] + " does not exist");
+        }
+        return;
+    }
+
+    // A blit trace is replayed without running a script
+    if (keys.find("blits") != keys.end()) {
+
+        if (!util::fileExists(keys["blits"])) {
+            throw SyntaxError("File " + keys["blits"] + " does not exist");
+        }
+        return;
+    }
+
+    // A self test doesn't take any files
+    if (keys.find("selftest") != keys.end()) {
+
+        if (keys.find("arg1") != keys.end()) {
+            throw SyntaxError("A self test doesn't take any files");
+        }
+        return;
+    }
+
+    // A timeline recording needs a frame number and a Kickstart Rom
+    if (keys.find("timeline") != keys.end()) {
+
+        try { util::parseNum(keys["timeline"]); } catch (...) {
+            throw SyntaxError("Invalid frame number '" + keys["timeline"] + "'");
+        }
+        if (keys.find("arg1") == keys.end()) {
+            throw SyntaxError("No Kickstart Rom is given");
+        }
+    }
+
+    // Timelines and benchmarks take an optional Kickstart Rom and extension Rom
+    if (keys.find("perf") != keys.end() || keys.find("timeline") != keys.end()) {
+
+        if (keys.find("arg3") != keys.end()) {
+            throw SyntaxError("More than two Rom files are given");
+        }
+        for (auto key : { "arg1", "arg2" }) {
+
+            if (keys.find(key) != keys.end() && !util::fileExists(keys[key])) {
+                throw SyntaxError("File " + keys[key] + " does not exist");
+            }
+        }
+        return;
+    }
+
     // The user needs to specify a single input file
     if (keys.find("arg1") == keys.end()) {
         throw SyntaxError("No script file is given");
@@ -166,6 +310,374 @@ Headless::checkArguments()
     }
 }
 
+void
+Headless::runBenchmark(const string &name)
+{
+    if (name == "guards") {
+
+        setupBenchmark();
+        benchmarkGuards();
+        return;
+    }
+    if (name == "instances") {
+
+        benchmarkInstances();
+        return;
+    }
+    if (name == "blitter") {
+
+        setupBenchmark();
+        benchmarkBlitter();
+        return;
+    }
+    if (name == "memory") {
+
+        // Add Fast Ram which is mapped in by the Kickstart
+        amiga.configure(OPT_FAST_RAM, 1024);
+        setupBenchmark();
+        benchmarkMemory();
+        return;
+    }
+
+    throw SyntaxError("Unknown benchmark '" + name + "'");
+}
+
+void
+Headless::setupBenchmark()
+{
+    if (keys.find("arg1") == keys.end()) {
+        throw SyntaxError("This benchmark requires a Kickstart Rom");
+    }
+
+    powerOn();
+
+    // Give the Kickstart some time to boot
+    runFrames(200);
+}
+
+void
+Headless::powerOn()
+{
+    amiga.configure(CONFIG_A500_ECS_1MB);
+    amiga.mem.loadRom(keys["arg1"]);
+    if (keys.find("arg2") != keys.end()) amiga.mem.loadExt(keys["arg2"]);
+    amiga.powerOn();
+}
+
+double
+Headless::runFrames(isize frames)
+{
+    /* Benchmarks drive the emulator directly from the calling thread. The
+     * emulator thread stays in paused state and doesn't interfere.
+     */
+    util::Clock clock;
+    for (isize i = 0; i < frames; i++) amiga.execute();
+    return clock.stop().asSeconds();
+}
+
+void
+Headless::benchmarkGuards()
+{
+    constexpr isize frames = 50;
+    constexpr isize rounds = 8;
+    constexpr isize counts[] = { 0, 10, 100, 1000 };
+
+    auto &breakpoints = amiga.cpu.debugger.breakpoints;
+    auto &watchpoints = amiga.cpu.debugger.watchpoints;
+
+    std::cout << "Breakpoints and watchpoints (best of " << rounds;
+    std::cout << " x " << frames << " frames)" << std::endl << std::endl;
+
+    /* The guard counts are measured in turns, starting with a different count
+     * in each round. This way, all counts see the same mix of emulated
+     * workloads and host disturbances.
+     */
+    double best[std::size(counts)] = { };
+
+    for (isize round = 0; round < rounds; round++) {
+
+        for (usize k = 0; k < std::size(counts); k++) {
+
+            auto c = (k + usize(round)) % std::size(counts);
+
+            breakpoints.removeAll();
+            watchpoints.removeAll();
+
+            /* Breakpoints are placed inside the Rom area, watchpoints inside
+             * an unmapped area. All guards are placed at odd addresses which
+             * are never hit by instruction fetches or word accesses.
+             */
+            for (isize i = 0; i < counts[c]; i++) {
+
+                breakpoints.setAt(u32(0xF80001 + 2 * i));
+                watchpoints.setAt(u32(0x600001 + 0x100 * i));
+            }
+
+            best[c] = std::max(best[c], double(frames) / runFrames(frames));
+        }
+    }
+
+    for (usize c = 0; c < std::size(counts); c++) {
+
+        char line[96];
+        snprintf(line, sizeof(line), "%6ld guards: %8.1f frames/s",
+                 long(counts[c]), best[c]);
+        std::cout << line << std::endl;
+    }
+
+    breakpoints.removeAll();
+    watchpoints.removeAll();
+}
+
+void
+Headless::benchmarkInstances()
+{
+    constexpr isize count = 8;
+
+    std::vector<std::unique_ptr<Amiga>> instances;
+    util::Clock clock;
+
+    std::cout << "Amiga instances (" << count << " instances)";
+    std::cout << std::endl << std::endl;
+
+    // Create the instances
+    clock.restart();
+    for (isize i = 0; i < count; i++) instances.push_back(std::make_unique<Amiga>());
+    auto create = clock.stop();
+
+    /* Switch the CPU model back and forth. The first switch to a model builds
+     * the shared jump tables of this model. All other switches reuse them.
+     */
+    clock.restart();
+    instances[0]->configure(OPT_CPU_REVISION, CPU_68010);
+    auto firstSwitch = clock.stop();
+
+    clock.restart();
+    for (isize i = 1; i < count; i++) instances[i]->configure(OPT_CPU_REVISION, CPU_68010);
+    for (isize i = 0; i < count; i++) instances[i]->configure(OPT_CPU_REVISION, CPU_68000);
+    auto otherSwitches = clock.stop();
+
+    auto ms = [](util::Time t, isize n) { return double(t.asNanoseconds()) / double(n) / 1000000.0; };
+
+    char line[96];
+    snprintf(line, sizeof(line), "%-28s%10.3f ms", "Construction", ms(create, count));
+    std::cout << line << std::endl;
+    snprintf(line, sizeof(line), "%-28s%10.3f ms", "CPU model switch (first)", ms(firstSwitch, 1));
+    std::cout << line << std::endl;
+    snprintf(line, sizeof(line), "%-28s%10.3f ms", "CPU model switch (others)", ms(otherSwitches, 2 * count - 1));
+    std::cout << line << std::endl;
+    snprintf(line, sizeof(line), "%-28s%10ld KB", "CPU object", long(sizeof(CPU) / 1024));
+    std::cout << line << std::endl;
+    snprintf(line, sizeof(line), "%-28s%10ld KB", "Amiga object", long(sizeof(Amiga) / 1024));
+    std::cout << line << std::endl;
+    snprintf(line, sizeof(line), "%-28s%10ld KB", "Heap memory per instance", long(instances[0]->memoryFootprint() / 1024));
+    std::cout << line << std::endl;
+    snprintf(line, sizeof(line), "%-28s%10ld KB", "Shared jump tables", long(moira::Moira::jumpTableFootprint() / 1024));
+    std::cout << line << std::endl;
+}
+
+void
+Headless::benchmarkBlitter()
+{
+    constexpr isize frames = 200;
+
+    /* A 68000 program that keeps the Blitter busy. It disables all interrupts
+     * and all DMA channels except the Blitter. In a loop, it waits for the
+     * Blitter, starts an A -> D copy of 64 x 512 words from $10000 to $40000,
+     * and runs a delay loop that doesn't touch Chip Ram.
+     */
+    static const u16 program[] = {
+
+        0x33FC, 0x7FFF, 0x00DF, 0xF09A,     //     move.w  #$7FFF,$DFF09A
+        0x33FC, 0x7FFF, 0x00DF, 0xF096,     //     move.w  #$7FFF,$DFF096
+        0x33FC, 0x8240, 0x00DF, 0xF096,     //     move.w  #$8240,$DFF096
+        0x46FC, 0x2700,                     //     move.w  #$2700,sr
+        0x4DF9, 0x00DF, 0xF000,             //     lea     $DFF000,a6
+        0x082E, 0x0006, 0x0002,             // 1:  btst    #6,2(a6)
+        0x66F8,                             //     bne.s   1b
+        0x3D7C, 0x09F0, 0x0040,             //     move.w  #$09F0,$40(a6)
+        0x3D7C, 0x0000, 0x0042,             //     move.w  #$0000,$42(a6)
+        0x2D7C, 0xFFFF, 0xFFFF, 0x0044,     //     move.l  #$FFFFFFFF,$44(a6)
+        0x2D7C, 0x0001, 0x0000, 0x0050,     //     move.l  #$10000,$50(a6)
+        0x2D7C, 0x0004, 0x0000, 0x0054,     //     move.l  #$40000,$54(a6)
+        0x3D7C, 0x0000, 0x0064,             //     move.w  #$0000,$64(a6)
+        0x3D7C, 0x0000, 0x0066,             //     move.w  #$0000,$66(a6)
+        0x3D7C, 0x8000, 0x0058,             //     move.w  #$8000,$58(a6)
+        0x303C, 0x07FF,                     //     move.w  #$07FF,d0
+        0x51C8, 0xFFFE,                     // 2:  dbra    d0,2b
+        0x6000, 0xFFB8                      //     bra.w   1b
+    };
+    constexpr u32 start = 0x60000;
+
+    auto &blitter = amiga.agnus.blitter;
+
+    std::cout << "Large copy blits (" << frames << " frames, ";
+    std::cout << std::thread::hardware_concurrency() << " host cores)";
+    std::cout << std::endl << std::endl;
+
+    // Install the program
+    for (isize i = 0; i < isize(sizeof(program) / 2); i++) {
+        amiga.mem.patch(u32(start + 2 * i), program[i]);
+    }
+    amiga.cpu.setSR(0x2700);
+    amiga.cpu.jump(start);
+
+    amiga.configure(OPT_BLITTER_ACCURACY, 0);
+
+    for (bool async : { false, true }) {
+
+        amiga.configure(OPT_BLITTER_ASYNC, async);
+
+        // Let the program settle and measure
+        runFrames(10);
+        auto before = blitter.getStats();
+        auto elapsed = runFrames(frames);
+        auto &after = blitter.getStats();
+
+        char line[128];
+        snprintf(line, sizeof(line), "%14s: %8.1f frames/s   %6ld async blits %6ld stalls",
+                 async ? "Asynchronous" : "Synchronous", double(frames) / elapsed,
+                 long(after.asyncBlits - before.asyncBlits),
+                 long(after.asyncStalls - before.asyncStalls));
+        std::cout << line << std::endl;
+    }
+
+    amiga.configure(OPT_BLITTER_ASYNC, false);
+}
+
+void
+Headless::benchmarkMemory()
+{
+    constexpr isize frames = 100;
+
+    /* A 68000 program that stresses a single kind of memory access. It
+     * disables all interrupts and all DMA channels and executes an unrolled
+     * loop of eight word reads or eight word writes. The program is placed
+     * in Fast Ram, so that instruction fetches take the same path in all
+     * runs. The accessed address is passed in a0.
+     */
+    u16 program[] = {
+
+        0x33FC, 0x7FFF, 0x00DF, 0xF09A,     //     move.w  #$7FFF,$DFF09A
+        0x33FC, 0x7FFF, 0x00DF, 0xF096,     //     move.w  #$7FFF,$DFF096
+        0x46FC, 0x2700,                     //     move.w  #$2700,sr
+        0x0000, 0x0000, 0x0000, 0x0000,     // 1:  <access> x 8
+        0x0000, 0x0000, 0x0000, 0x0000,
+        0x60EE                              //     bra.s   1b
+    };
+    constexpr isize loop = 10;
+
+    struct Access { const char *name; u16 opcode; };
+    static const Access accesses[] = {
+
+        { "peek16", 0x3210 },               //     move.w  (a0),d1
+        { "poke16", 0x3081 }                //     move.w  d1,(a0)
+    };
+
+    // Wait until the Kickstart has mapped in Fast Ram
+    u32 fast = 0;
+    for (isize frame = 0; frame < 500 && !fast; frame++) {
+
+        runFrames(1);
+        for (u32 bank = 0; bank < 0x100 && !fast; bank++) {
+            if (amiga.mem.cpuMemSrc[bank] == MEM_FAST) fast = bank << 16;
+        }
+    }
+    if (!fast) throw VAError(ERROR_OPT_UNSUPPORTED, "Fast Ram hasn't been mapped in");
+
+    struct Area { const char *name; u32 addr; };
+    const Area areas[] = {
+
+        { "Fast Ram", fast + 0x8000 },
+        { "Rom", 0xF80000 },
+        { "Chip Ram", 0x10000 }
+    };
+
+    std::cout << "CPU memory accesses (" << frames << " frames)";
+    std::cout << std::endl << std::endl;
+    std::cout << "                    stats off     stats on" << std::endl;
+
+    for (auto &area : areas) {
+
+        for (auto &access : accesses) {
+
+            // Install the program
+            for (isize i = 0; i < 8; i++) program[loop + i] = access.opcode;
+            for (isize i = 0; i < isize(sizeof(program) / 2); i++) {
+                amiga.mem.patch(u32(fast + 2 * i), program[i]);
+            }
+
+            double fps[2];
+
+            for (bool stats : { false, true }) {
+
+                amiga.configure(OPT_MEM_STATS, stats);
+                amiga.cpu.setSR(0x2700);
+                amiga.cpu.setA(0, area.addr);
+                amiga.cpu.jump(fast);
+
+                // Let the program settle and measure
+                runFrames(10);
+                fps[stats] = double(frames) / runFrames(frames);
+            }
+
+            char line[96];
+            snprintf(line, sizeof(line), "%8s %6s: %8.1f fps %8.1f fps",
+                     area.name, access.name, fps[0], fps[1]);
+            std::cout << line << std::endl;
+        }
+    }
+
+    amiga.configure(OPT_MEM_STATS, true);
+}
+
+void
+Headless::runSelfTest(const string &name)
+{
+    if (name == "blitter") {
+
+        // Compare the SIMD kernels with the word-by-word kernels
+        amiga.agnus.blitter.selfTest(100000, std::cout);
+        return;
+    }
+    if (name == "copper") {
+
+        // Compare the closed-form WAIT search with the iterative search
+        amiga.agnus.copper.selfTest(std::cout);
+        return;
+    }
+
+    throw SyntaxError("Unknown self test '" + name + "'");
+}
+
+void
+Headless::recordTimeline(i64 frame)
+{
+    auto &dmaDebugger = amiga.agnus.dmaDebugger;
+
+    powerOn();
+
+    /* Like the benchmarks, the recording drives the emulator directly from
+     * the calling thread. Frames are counted from power-on.
+     */
+    dmaDebugger.recordTimeline(frame);
+    while (dmaDebugger.isRecordingTimeline()) amiga.execute();
+
+    dmaDebugger.dumpTimeline(std::cout);
+
+    if (keys.find("output") != keys.end()) {
+
+        auto path = keys["output"];
+
+        if (util::extractSuffix(path) == "ppm") {
+            dmaDebugger.exportTimelinePPM(path);
+        } else {
+            dmaDebugger.exportTimeline(path);
+        }
+        std::cout << std::endl << "Timeline saved to " << path << std::endl;
+    }
+}
+
 void
 process(const void *listener, long type, i32 d1, i32 d2, i32 d3, i32 d4)
 {
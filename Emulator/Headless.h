@@ -11,6 +11,7 @@
 
 #include "Amiga.h"
 #include <map>
+#include <thread>
 
 using std::map;
 using std::vector;
@@ -54,6 +55,57 @@ private:
     void checkArguments() throws;
 
     
+    //
+    // Benchmarking
+    //
+
+private:
+
+    // Runs the benchmark with the specified name
+    void runBenchmark(const string &name) throws;
+
+    // Loads the Kickstart Rom given on the command line and boots the Amiga
+    void setupBenchmark() throws;
+
+    // Configures the Amiga with the Roms given on the command line
+    void powerOn() throws;
+
+    // Emulates the specified number of frames and returns the elapsed time
+    double runFrames(isize frames);
+
+    // Measures the emulation speed with a growing number of guards
+    void benchmarkGuards();
+
+    // Measures the construction time and memory footprint of Amiga instances
+    void benchmarkInstances();
+
+    // Measures the emulation speed with synchronous and asynchronous blits
+    void benchmarkBlitter();
+
+    // Measures the speed of CPU accesses to different memory areas
+    void benchmarkMemory();
+
+
+    //
+    // Testing
+    //
+
+private:
+
+    // Runs the self test with the specified name
+    void runSelfTest(const string &name) throws;
+
+
+    //
+    // Recording
+    //
+
+private:
+
+    // Records and reports the DMA timeline of the specified frame
+    void recordTimeline(i64 frame) throws;
+
+    
     //
     // Running
     //
@@ -0,0 +1,200 @@
+// -----------------------------------------------------------------------------
+// This file is part of vAmiga
+//
+// Copyright (C) Dirk W. Hoffmann. www.dirkwhoffmann.de
+// Licensed under the GNU General Public License v3
+//
+// See https://www.gnu.org for license information
+// -----------------------------------------------------------------------------
+
+#include "config.h"
+#include "Heatmap.h"
+#include "Error.h"
+#include "IOUtils.h"
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+
+void
+Heatmap::start()
+{
+    current.assign(tableSize, 0);
+    latest.assign(tableSize, 0);
+    total.assign(tableSize, 0);
+    frames = 0;
+
+    enabled = true;
+}
+
+void
+Heatmap::stop()
+{
+    enabled = false;
+}
+
+void
+Heatmap::clear()
+{
+    std::fill(current.begin(), current.end(), 0);
+    std::fill(latest.begin(), latest.end(), 0);
+    std::fill(total.begin(), total.end(), 0);
+    frames = 0;
+}
+
+void
+Heatmap::eofHandler()
+{
+    if (!enabled) return;
+
+    for (isize i = 0; i < tableSize; i++) total[i] += current[i];
+
+    std::swap(current, latest);
+    std::fill(current.begin(), current.end(), 0);
+    frames++;
+}
+
+isize
+Heatmap::footprint() const
+{
+    return isize(current.capacity() * sizeof(u32) +
+                 latest.capacity() * sizeof(u32) +
+                 total.capacity() * sizeof(u64));
+}
+
+u64
+Heatmap::count(HeatClient client, bool write, isize page, bool cumulative) const
+{
+    auto i = (client * 2 + write) * pageCount + page;
+
+    if (cumulative) return i < isize(total.size()) ? total[i] : 0;
+    return i < isize(latest.size()) ? latest[i] : 0;
+}
+
+void
+Heatmap::dump(std::ostream& os) const
+{
+    using namespace util;
+
+    os << tab("Recording");
+    os << bol(enabled) << std::endl;
+    os << tab("Frames");
+    os << dec(frames) << std::endl;
+
+    if (total.empty()) return;
+
+    // Sum up the accesses per client and per page
+    u64 reads[HEAT_COUNT] = { }, writes[HEAT_COUNT] = { };
+    std::vector<std::pair<u64, isize>> pages;
+
+    for (isize p = 0; p < pageCount; p++) {
+
+        u64 sum = 0;
+
+        for (isize c = 0; c < HEAT_COUNT; c++) {
+
+            auto r = count(HeatClient(c), false, p, true);
+            auto w = count(HeatClient(c), true, p, true);
+            reads[c] += r;
+            writes[c] += w;
+            sum += r + w;
+        }
+        if (sum) pages.push_back( { sum, p } );
+    }
+
+    os << std::endl;
+    for (isize c = 0; c < HEAT_COUNT; c++) {
+
+        os << tab(HeatClientEnum::key(HeatClient(c)));
+        os << dec(reads[c]) << " reads, " << dec(writes[c]) << " writes" << std::endl;
+    }
+
+    // List the hottest pages
+    std::sort(pages.begin(), pages.end(), std::greater<>());
+
+    os << std::endl;
+    for (isize i = 0; i < std::min(isize(pages.size()), isize(10)); i++) {
+
+        char addr[16];
+        snprintf(addr, sizeof(addr), "%06lx", long(pages[i].second << 12));
+        os << tab(addr);
+        os << dec(pages[i].first) << " accesses" << std::endl;
+    }
+}
+
+void
+Heatmap::exportCSV(const string &path, bool cumulative) const
+{
+    std::ofstream stream(path);
+    if (!stream.is_open()) throw VAError(ERROR_FILE_CANT_CREATE, path);
+
+    // Write the header
+    stream << "page,address";
+    for (isize c = 0; c < HEAT_COUNT; c++) {
+
+        auto name = HeatClientEnum::key(HeatClient(c));
+        stream << "," << name << "_reads," << name << "_writes";
+    }
+    stream << "\n";
+
+    // Write a line for each page that has been accessed
+    for (isize p = 0; p < pageCount; p++) {
+
+        u64 values[2 * HEAT_COUNT];
+        u64 sum = 0;
+
+        for (isize c = 0; c < HEAT_COUNT; c++) {
+
+            sum += values[2 * c] = count(HeatClient(c), false, p, cumulative);
+            sum += values[2 * c + 1] = count(HeatClient(c), true, p, cumulative);
+        }
+        if (sum == 0) continue;
+
+        char addr[16];
+        snprintf(addr, sizeof(addr), "%06lx", long(p << 12));
+        stream << p << "," << addr;
+        for (isize i = 0; i < 2 * HEAT_COUNT; i++) stream << "," << values[i];
+        stream << "\n";
+    }
+}
+
+void
+Heatmap::exportPGM(const string &path, bool cumulative) const
+{
+    constexpr isize panel = 64;
+    constexpr isize gap = 1;
+    constexpr isize width = HEAT_COUNT * (panel + gap) - gap;
+    constexpr isize height = 2 * panel + gap;
+
+    std::ofstream stream(path, std::ios::binary);
+    if (!stream.is_open()) throw VAError(ERROR_FILE_CANT_CREATE, path);
+
+    // Determine the maximum counter value for scaling
+    u64 max = 0;
+    for (isize c = 0; c < HEAT_COUNT; c++) {
+        for (isize p = 0; p < pageCount; p++) {
+
+            max = std::max(max, count(HeatClient(c), false, p, cumulative));
+            max = std::max(max, count(HeatClient(c), true, p, cumulative));
+        }
+    }
+    double scale = max ? 255.0 / std::log2(double(max) + 1) : 0;
+
+    // Render the panels (the gaps stay white)
+    std::vector<u8> image(width * height, 255);
+
+    for (isize c = 0; c < HEAT_COUNT; c++) {
+        for (isize w = 0; w < 2; w++) {
+            for (isize p = 0; p < pageCount; p++) {
+
+                auto x = c * (panel + gap) + p % panel;
+                auto y = w * (panel + gap) + p / panel;
+                auto value = count(HeatClient(c), w, p, cumulative);
+
+                image[y * width + x] = u8(std::log2(double(value) + 1) * scale);
+            }
+        }
+    }
+
+    stream << "P5\n" << width << " " << height << "\n255\n";
+    stream.write((const char *)image.data(), image.size());
+}
@@ -0,0 +1,132 @@
+// -----------------------------------------------------------------------------
+// This file is part of vAmiga
+//
+// Copyright (C) Dirk W. Hoffmann. www.dirkwhoffmann.de
+// Licensed under the GNU General Public License v3
+//
+// See https://www.gnu.org for license information
+// -----------------------------------------------------------------------------
+
+#pragma once
+
+#include "MemoryTypes.h"
+#include "Exception.h"
+#include <vector>
+
+/* The heatmap counts memory accesses per 4 KB page of the 24-bit address
+ * space. Reads and writes are counted separately for each client, i.e., the
+ * CPU, the DMA channels of Agnus, and the debugger. The counters of the frame
+ * that is currently emulated are added to a cumulative table and preserved
+ * for inspection when the frame ends.
+ *
+ * The heatmap is only available if MEM_HEATMAP is set in config.h. Otherwise,
+ * the recording functions compile to nothing and isEnabled() is constantly
+ * false, which removes all heatmap checks from the DMA and Blitter paths.
+ * If the heatmap is compiled in, it is disabled by default. In this state,
+ * the counter tables are not allocated and the recording functions reduce
+ * to a single check of the enable flag. Moreover, the direct page pointers
+ * of the CPU stay in place, which means that most CPU accesses never reach
+ * the heatmap at all.
+ */
+
+class Heatmap {
+
+public:
+
+    // Number of 4 KB pages in the 24-bit address space
+    static constexpr isize pageCount = 4096;
+
+    // Number of counters per table
+    static constexpr isize tableSize = HEAT_COUNT * 2 * pageCount;
+
+private:
+
+    // Indicates if accesses are recorded
+    bool enabled = false;
+
+    // Access counters of the current frame
+    std::vector<u32> current;
+
+    // Access counters of the latest completed frame
+    std::vector<u32> latest;
+
+    // Access counters accumulated over all completed frames
+    std::vector<u64> total;
+
+    // Number of completed frames
+    i64 frames = 0;
+
+
+    //
+    // Controlling
+    //
+
+public:
+
+    // Starts recording (all counters are cleared)
+    void start();
+
+    // Stops recording (the recorded data is kept)
+    void stop();
+
+    // Clears all counters
+    void clear();
+
+    // Returns true if accesses are recorded
+    bool isEnabled() const { return MEM_HEATMAP && enabled; }
+
+    // Returns the number of completed frames
+    i64 numFrames() const { return frames; }
+
+    // Returns the number of bytes allocated for the counter tables
+    isize footprint() const;
+
+    // Prints a summary
+    void dump(std::ostream& os) const;
+
+
+    //
+    // Recording
+    //
+
+public:
+
+    template <HeatClient C> void read(u32 addr) {
+        if constexpr (MEM_HEATMAP) { if (enabled) current[index(C, false, addr)]++; }
+    }
+    template <HeatClient C> void write(u32 addr) {
+        if constexpr (MEM_HEATMAP) { if (enabled) current[index(C, true, addr)]++; }
+    }
+
+    // Finishes the current frame
+    void eofHandler();
+
+private:
+
+    static isize index(HeatClient client, bool write, u32 addr) {
+        return (client * 2 + write) * pageCount + ((addr >> 12) & 0xFFF);
+    }
+
+    // Returns a counter of the latest frame or the cumulated counter
+    u64 count(HeatClient client, bool write, isize page, bool cumulative) const;
+
+
+    //
+    // Exporting
+    //
+
+public:
+
+    /* Writes the recorded data into a CSV file. Each line contains the reads
+     * and writes of all clients for a single page. Pages which haven't been
+     * accessed at all are omitted.
+     */
+    void exportCSV(const string &path, bool cumulative) const throws;
+
+    /* Writes the recorded data into a PGM image. The image is composed of
+     * one 64 x 64 panel per client and access type, each pixel representing
+     * a single page. Reads are shown in the upper row of panels, writes in
+     * the lower row. The brightness is scaled logarithmically.
+     */
+    void exportPGM(const string &path, bool cumulative) const throws;
+};
@@ -22,6 +22,8 @@
 #include "RTC.h"
 #include "ZorroManager.h"
 
+const u8 Memory::zeroPage[Memory::ramPageSize] = { };
+
 void
 Memory::_dump(Category category, std::ostream& os) const
 {
@@ -51,6 +53,8 @@ Memory::_dump(Category category, std::ostream& os) const
         os << RamInitPatternEnum::key(config.ramInitPattern) << std::endl;
         os << util::tab("Unmapped memory");
         os << UnmappedMemoryEnum::key(config.unmappingType) << std::endl;
+        os << util::tab("Record statistics");
+        os << util::bol(config.stats) << std::endl;
     }
     
     if (category == Category::State) {
@@ -59,10 +63,24 @@ Memory::_dump(Category category, std::ostream& os) const
         os << util::hex(dataBus) << std::endl;
         os << util::tab("Wom is locked");
         os << util::bol(womIsLocked) << std::endl;
+        os << util::tab("Slow Ram in use");
+        os << util::dec(usedPages(slowPages, config.slowSize) * ramPageSize / 1024) << " KB" << std::endl;
+        os << util::tab("Fast Ram in use");
+        os << util::dec(usedPages(fastPages, config.fastSize) * ramPageSize / 1024) << " KB" << std::endl;
     }
     
     if (category == Category::Checksums) {
-        
+
+        // Slow Ram and Fast Ram are checked page by page (skipping unallocated pages)
+        auto fnv32 = [&](const Buffer<u8> *pages, isize size) {
+
+            u32 result = util::fnvInit32();
+            for (isize i = 0; i < size / ramPageSize; i++) {
+                if (pages[i].ptr) result = util::fnvIt32(util::fnvIt32(result, u32(i)), pages[i].fnv32());
+            }
+            return result;
+        };
+
         os << util::tab("Rom checksum");
         os << util::hex(util::fnv32(rom, config.romSize)) << std::endl;
         os << util::tab("Wom checksum");
@@ -72,9 +90,9 @@ Memory::_dump(Category category, std::ostream& os) const
         os << util::tab("Chip Ram checksum");
         os << util::hex(util::fnv32(chip, config.chipSize)) << std::endl;
         os << util::tab("Slow Ram checksum");
-        os << util::hex(util::fnv32(slow, config.slowSize)) << std::endl;
+        os << util::hex(fnv32(slowPages, config.slowSize)) << std::endl;
         os << util::tab("Fast Ram checksum");
-        os << util::hex(util::fnv32(fast, config.fastSize)) << std::endl;
+        os << util::hex(fnv32(fastPages, config.fastSize)) << std::endl;
     }
     
     if (category == Category::BankMap) {
@@ -143,6 +161,30 @@ Memory::_reset(bool hard)
     clearStats();
 }
 
+void
+Memory::_didLoad()
+{
+    // Rebuild the direct page pointers from the restored memory source table
+    updateCpuPagePtrs();
+}
+
+isize
+Memory::_memoryFootprint() const
+{
+    isize result = 0;
+
+    result += romAllocator.bytesize();
+    result += womAllocator.bytesize();
+    result += extAllocator.bytesize();
+    result += chipAllocator.bytesize();
+    for (auto &page : slowPages) result += page.bytesize();
+    for (auto &page : fastPages) result += page.bytesize();
+    result += heatmap.footprint();
+    result += histogram.footprint();
+
+    return result;
+}
+
 void
 Memory::resetConfig()
 {
@@ -159,7 +201,8 @@ Memory::resetConfig()
         OPT_SLOW_RAM_DELAY,
         OPT_BANKMAP,
         OPT_UNMAPPING_TYPE,
-        OPT_RAM_INIT_PATTERN
+        OPT_RAM_INIT_PATTERN,
+        OPT_MEM_STATS
     };
 
     for (auto &option : options) {
@@ -181,6 +224,7 @@ Memory::getConfigItem(Option option) const
         case OPT_BANKMAP:           return config.bankMap;
         case OPT_UNMAPPING_TYPE:    return config.unmappingType;
         case OPT_RAM_INIT_PATTERN:  return config.ramInitPattern;
+        case OPT_MEM_STATS:         return config.stats;
 
         default:
             fatalError;
@@ -284,6 +328,13 @@ Memory::setConfigItem(Option option, i64 value)
             if (isPoweredOff()) fillRamWithInitPattern();
             return;
 
+        case OPT_MEM_STATS:
+        {
+            SUSPENDED
+            config.stats = value;
+            return;
+        }
+
         default:
             fatalError;
     }
@@ -317,8 +368,15 @@ Memory::_size()
     counter.count += womSize;
     counter.count += extSize;
     counter.count += chipSize;
-    counter.count += slowSize;
-    counter.count += fastSize;
+
+    // Slow Ram and Fast Ram are stored sparsely (see saveSparse)
+    for (auto pages : { usedPages(slowPages, slowSize), usedPages(fastPages, fastSize) }) {
+
+        i32 count = 0, page = 0;
+        counter << count;
+        for (isize i = 0; i < pages; i++) counter << page;
+        counter.count += pages * ramPageSize;
+    }
 
     return counter.count;
 }
@@ -334,11 +392,16 @@ Memory::_checksum()
     if (config.chipSize) {
         for (isize i = 0; i < config.chipSize; i++) checker << chip[i];
     }
-    if (config.slowSize) {
-        for (isize i = 0; i < config.slowSize; i++) checker << slow[i];
-    }
-    if (config.fastSize) {
-        for (isize i = 0; i < config.fastSize; i++) checker << fast[i];
+    // Slow Ram and Fast Ram are checked sparsely (unallocated pages are skipped)
+    for (auto [pages, size] : { std::pair(slowPages, config.slowSize), std::pair(fastPages, config.fastSize) }) {
+
+        for (isize i = 0; i < size / ramPageSize; i++) {
+
+            if (!pages[i].ptr) continue;
+
+            checker << i;
+            for (isize j = 0; j < ramPageSize; j++) checker << pages[i][j];
+        }
     }
     
     return checker.hash;
@@ -382,8 +445,8 @@ Memory::didLoadFromBuffer(const u8 *buffer)
     reader.copy(wom, womSize);
     reader.copy(ext, extSize);
     reader.copy(chip, chipSize);
-    reader.copy(slow, slowSize);
-    reader.copy(fast, fastSize);
+    loadSparse(reader, slowPages, slowSize);
+    loadSparse(reader, fastPages, fastSize);
 
     return (isize)(reader.ptr - buffer);
 }
@@ -415,8 +478,8 @@ Memory::didSaveToBuffer(u8 *buffer)
     writer.copy(wom, womSize);
     writer.copy(ext, extSize);
     writer.copy(chip, chipSize);
-    writer.copy(slow, slowSize);
-    writer.copy(fast, fastSize);
+    saveSparse(writer, slowPages, slowSize);
+    saveSparse(writer, fastPages, fastSize);
     
     return (isize)(writer.ptr - buffer);
 }
@@ -480,15 +543,13 @@ Memory::allocChip(i32 bytes, bool update)
 void
 Memory::allocSlow(i32 bytes, bool update)
 {
-    config.slowSize = bytes;
-    alloc(slowAllocator, bytes, update);
+    alloc(slowPages, config.slowSize, bytes, update);
 }
 
 void
 Memory::allocFast(i32 bytes, bool update)
 {
-    config.fastSize = bytes;
-    alloc(fastAllocator, bytes, update);
+    alloc(fastPages, config.fastSize, bytes, update);
 }
             
 void
@@ -535,6 +596,22 @@ Memory::alloc(Allocator<u8> &allocator, isize bytes, u32 &mask, bool update)
     alloc(allocator, bytes, update);
 }
 
+template <isize N> void
+Memory::alloc(Buffer<u8> (&pages)[N], i32 &size, i32 bytes, bool update)
+{
+    assert(bytes % ramPageSize == 0 && bytes / ramPageSize <= N);
+
+    // Only proceed if memory layout will change
+    if (bytes == size) return;
+
+    // Start over with unallocated pages
+    freePages(pages);
+    size = bytes;
+
+    // Update the memory source tables if requested
+    if (update) updateMemSrcTables();
+}
+
 void
 Memory::fillRamWithInitPattern()
 {
@@ -546,22 +623,27 @@ Memory::fillRamWithInitPattern()
 
             srand(0);
             if (chip) for (isize i = 0; i < config.chipSize; i++) chip[i] = (u8)rand();
-            if (slow) for (isize i = 0; i < config.slowSize; i++) slow[i] = (u8)rand();
-            if (fast) for (isize i = 0; i < config.fastSize; i++) fast[i] = (u8)rand();
+            for (isize i = 0; i < config.slowSize; i++) *ramWritePtr(slowPages, u32(i)) = (u8)rand();
+            for (isize i = 0; i < config.fastSize; i++) *ramWritePtr(fastPages, u32(i)) = (u8)rand();
             break;
             
         case RAM_INIT_ALL_ZEROES:
 
+            // Unallocated pages of Slow Ram and Fast Ram read as zero
             if (chip) std::memset(chip, 0x00, config.chipSize);
-            if (slow) std::memset(slow, 0x00, config.slowSize);
-            if (fast) std::memset(fast, 0x00, config.fastSize);
+            freePages(slowPages);
+            freePages(fastPages);
             break;
             
         case RAM_INIT_ALL_ONES:
             
             if (chip) std::memset(chip, 0xFF, config.chipSize);
-            if (slow) std::memset(slow, 0xFF, config.slowSize);
-            if (fast) std::memset(fast, 0xFF, config.fastSize);
+            for (isize i = 0; i < config.slowSize; i += ramPageSize) {
+                std::memset(ramWritePtr(slowPages, u32(i)), 0xFF, ramPageSize);
+            }
+            for (isize i = 0; i < config.fastSize; i += ramPageSize) {
+                std::memset(ramWritePtr(fastPages, u32(i)), 0xFF, ramPageSize);
+            }
             break;
             
         default:
@@ -569,6 +651,75 @@ Memory::fillRamWithInitPattern()
     }
 }
 
+void
+Memory::allocPage(Buffer<u8> &page)
+{
+    assert(!page.ptr);
+
+    page.init(ramPageSize);
+
+    // Let the CPU access the new page directly
+    updateCpuPagePtrs();
+}
+
+template <isize N> void
+Memory::freePages(Buffer<u8> (&pages)[N])
+{
+    for (auto &page : pages) page.dealloc();
+
+    // Remove all direct page pointers into the freed pages
+    updateCpuPagePtrs();
+}
+
+isize
+Memory::usedPages(const Buffer<u8> *pages, isize size) const
+{
+    assert(size % ramPageSize == 0);
+
+    isize result = 0;
+    for (isize i = 0; i < size / ramPageSize; i++) {
+        if (pages[i].ptr) result++;
+    }
+    return result;
+}
+
+void
+Memory::saveSparse(util::SerWriter &writer, const Buffer<u8> *pages, isize size)
+{
+    i32 count = (i32)usedPages(pages, size);
+    writer << count;
+
+    for (isize i = 0; i < size / ramPageSize; i++) {
+
+        if (pages[i].ptr) {
+
+            i32 page = (i32)i;
+            writer << page;
+            writer.copy(pages[i].ptr, ramPageSize);
+        }
+    }
+}
+
+void
+Memory::loadSparse(util::SerReader &reader, Buffer<u8> *pages, isize size)
+{
+    i32 count, page;
+    reader << count;
+
+    if (count < 0 || count > size / ramPageSize) throw VAError(ERROR_SNAP_CORRUPTED);
+
+    // Pages not contained in the snapshot are unallocated
+    for (isize i = 0; i < size / ramPageSize; i++) pages[i].dealloc();
+
+    for (isize i = 0; i < count; i++) {
+
+        reader << page;
+        if (page < 0 || page >= size / ramPageSize) throw VAError(ERROR_SNAP_CORRUPTED);
+        if (!pages[page].ptr) pages[page].alloc(ramPageSize);
+        reader.copy(pages[page].ptr, ramPageSize);
+    }
+}
+
 u32
 Memory::romFingerprint() const
 {
@@ -920,9 +1071,74 @@ Memory::updateCpuMemSrcTable()
     // Expansion boards
     zorro.updateMemSrcTables();
 
+    // Direct page pointers
+    updateCpuPagePtrs();
+
     msgQueue.put(MSG_MEM_LAYOUT);
 }
 
+void
+Memory::updateCpuPagePtrs()
+{
+    // Start from scratch
+    for (isize i = 0x00; i <= 0xFF; i++) {
+        cpuReadPtr[i] = cpuWritePtr[i] = { nullptr, nullptr };
+    }
+
+    // Route all accesses through the slow path while the heatmap is recorded
+    if (heatmap.isEnabled()) return;
+
+    // Determines the host address of a bank in a mirrored memory area
+    auto mirrored = [](u8 *mem, u32 mask, isize bank) -> u8 * {
+        return mem && mask >= 0xFFFF ? mem + ((bank << 16) & mask) : nullptr;
+    };
+
+    // Fast Ram is mapped in one piece by the Ram expansion board
+    isize firstFastBank = -1;
+
+    for (isize i = 0x00; i <= 0xFF; i++) {
+
+        switch (cpuMemSrc[i]) {
+
+            case MEM_FAST:
+
+                // Unallocated pages are allocated by the slow path
+                if (firstFastBank < 0) firstFastBank = i;
+                cpuReadPtr[i].base = fastPages[i - firstFastBank].ptr;
+                cpuReadPtr[i].counter = &stats.fastReads.raw;
+                cpuWritePtr[i].base = cpuReadPtr[i].base;
+                cpuWritePtr[i].counter = &stats.fastWrites.raw;
+                break;
+
+            case MEM_ROM:
+            case MEM_ROM_MIRROR:
+
+                cpuReadPtr[i].base = mirrored(rom, romMask, i);
+                cpuReadPtr[i].counter = &stats.kickReads.raw;
+                break;
+
+            case MEM_WOM:
+
+                cpuReadPtr[i].base = mirrored(wom, womMask, i);
+                cpuReadPtr[i].counter = &stats.kickReads.raw;
+                break;
+
+            case MEM_EXT:
+
+                cpuReadPtr[i].base = mirrored(ext, extMask, i);
+                cpuReadPtr[i].counter = &stats.kickReads.raw;
+                break;
+
+            default:
+
+                /* Chip Ram and Slow Ram are not handled here, because the
+                 * CPU has to wait for a free bus before accessing them.
+                 */
+                break;
+        }
+    }
+}
+
 void
 Memory::updateAgnusMemSrcTable()
 {
@@ -946,6 +1162,46 @@ Memory::updateAgnusMemSrcTable()
     }
 }
 
+void
+Memory::startHeatmap()
+{
+    if (!MEM_HEATMAP) throw VAError(ERROR_OPT_UNSUPPORTED);
+
+    {   SUSPENDED
+
+        heatmap.start();
+        updateCpuPagePtrs();
+    }
+}
+
+void
+Memory::stopHeatmap()
+{
+    {   SUSPENDED
+
+        heatmap.stop();
+        updateCpuPagePtrs();
+    }
+}
+
+void
+Memory::startHistogram()
+{
+    {   SUSPENDED
+
+        histogram.start();
+    }
+}
+
+void
+Memory::stopHistogram()
+{
+    {   SUSPENDED
+
+        histogram.stop();
+    }
+}
+
 bool
 Memory::inChipRam(u32 addr)
 {
@@ -1045,8 +1301,8 @@ Memory::peek8 <ACCESSOR_CPU, MEM_CHIP> (u32 addr)
 {
     ASSERT_CHIP_ADDR(addr);
     agnus.executeUntilBusIsFree();
+    blitter.willReadChip(addr);
     
-    stats.chipReads.raw++;
     dataBus = READ_CHIP_8(addr);
     return (u8)dataBus;
 }
@@ -1056,8 +1312,8 @@ Memory::peek16 <ACCESSOR_CPU, MEM_CHIP> (u32 addr)
 {
     ASSERT_CHIP_ADDR(addr);
     agnus.executeUntilBusIsFree();
+    blitter.willReadChip(addr);
     
-    stats.chipReads.raw++;
     dataBus = READ_CHIP_16(addr);
     return dataBus;
 }
@@ -1074,7 +1330,6 @@ Memory::peek8 <ACCESSOR_CPU, MEM_SLOW> (u32 addr)
     ASSERT_SLOW_ADDR(addr);
     agnus.executeUntilBusIsFree();
     
-    stats.slowReads.raw++;
     dataBus = READ_SLOW_8(addr);
     return (u8)dataBus;
 }
@@ -1085,7 +1340,6 @@ Memory::peek16 <ACCESSOR_CPU, MEM_SLOW> (u32 addr)
     ASSERT_SLOW_ADDR(addr);
     agnus.executeUntilBusIsFree();
     
-    stats.slowReads.raw++;
     dataBus = READ_SLOW_16(addr);
     return dataBus;
 }
@@ -1101,7 +1355,6 @@ Memory::peek8 <ACCESSOR_CPU, MEM_FAST> (u32 addr)
 {
     ASSERT_FAST_ADDR(addr);
     
-    stats.fastReads.raw++;
     return READ_FAST_8(addr);
 }
 
@@ -1110,7 +1363,6 @@ Memory::peek16 <ACCESSOR_CPU, MEM_FAST> (u32 addr)
 {
     ASSERT_FAST_ADDR(addr);
     
-    stats.fastReads.raw++;
     return READ_FAST_16(addr);
 }
 
@@ -1273,7 +1525,6 @@ Memory::peek8 <ACCESSOR_CPU, MEM_ROM> (u32 addr)
 {
     ASSERT_ROM_ADDR(addr);
     
-    stats.kickReads.raw++;
     return READ_ROM_8(addr);
 }
 
@@ -1282,7 +1533,6 @@ Memory::peek16 <ACCESSOR_CPU, MEM_ROM> (u32 addr)
 {
     ASSERT_ROM_ADDR(addr);
     
-    stats.kickReads.raw++;
     return READ_ROM_16(addr);
 }
 
@@ -1297,7 +1547,6 @@ Memory::peek8 <ACCESSOR_CPU, MEM_WOM> (u32 addr)
 {
     ASSERT_WOM_ADDR(addr);
     
-    stats.kickReads.raw++;
     return READ_WOM_8(addr);
 }
 
@@ -1306,7 +1555,6 @@ Memory::peek16 <ACCESSOR_CPU, MEM_WOM> (u32 addr)
 {
     ASSERT_WOM_ADDR(addr);
     
-    stats.kickReads.raw++;
     return READ_WOM_16(addr);
 }
 
@@ -1321,7 +1569,6 @@ Memory::peek8 <ACCESSOR_CPU, MEM_EXT> (u32 addr)
 {
     ASSERT_EXT_ADDR(addr);
     
-    stats.kickReads.raw++;
     return READ_EXT_8(addr);
 }
 
@@ -1330,7 +1577,6 @@ Memory::peek16 <ACCESSOR_CPU, MEM_EXT> (u32 addr)
 {
     ASSERT_EXT_ADDR(addr);
     
-    stats.kickReads.raw++;
     return READ_EXT_16(addr);
 }
 
@@ -1340,9 +1586,19 @@ Memory::spypeek16 <ACCESSOR_CPU, MEM_EXT> (u32 addr) const
     return READ_EXT_16(addr);
 }
 
-template<> u8
-Memory::peek8 <ACCESSOR_CPU> (u32 addr)
+template <bool track> u8
+Memory::cpuPeek8(u32 addr)
 {
+    // Fast path: Access the host memory directly if possible
+    if (auto &page = cpuReadPtr[(addr & 0xFFFFFF) >> 16]; page.base) {
+
+        if constexpr (track) (*page.counter)++;
+        return R8BE(page.base + (addr & 0xFFFF));
+    }
+
+    heatmap.read <HEAT_CPU> (addr);
+    if constexpr (track) countRead(cpuMemSrc[(addr & 0xFFFFFF) >> 16]);
+
     switch (cpuMemSrc[(addr & 0xFFFFFF) >> 16]) {
             
         case MEM_NONE:          return peek8 <ACCESSOR_CPU, MEM_NONE>     (addr);
@@ -1367,9 +1623,25 @@ Memory::peek8 <ACCESSOR_CPU> (u32 addr)
     }
 }
 
-template<> u16
-Memory::peek16 <ACCESSOR_CPU> (u32 addr)
+template<> u8
+Memory::peek8 <ACCESSOR_CPU> (u32 addr)
+{
+    return config.stats ? cpuPeek8 <true> (addr) : cpuPeek8 <false> (addr);
+}
+
+template <bool track> u16
+Memory::cpuPeek16(u32 addr)
 {
+    // Fast path: Access the host memory directly if possible
+    if (auto &page = cpuReadPtr[(addr & 0xFFFFFF) >> 16]; page.base) {
+
+        if constexpr (track) (*page.counter)++;
+        return R16BE(page.base + (addr & 0xFFFF));
+    }
+
+    heatmap.read <HEAT_CPU> (addr);
+    if constexpr (track) countRead(cpuMemSrc[(addr & 0xFFFFFF) >> 16]);
+
     switch (cpuMemSrc[(addr & 0xFFFFFF) >> 16]) {
             
         case MEM_NONE:          return peek16 <ACCESSOR_CPU, MEM_NONE>     (addr);
@@ -1393,6 +1665,12 @@ Memory::peek16 <ACCESSOR_CPU> (u32 addr)
             fatalError;
     }
 }
+
+template<> u16
+Memory::peek16 <ACCESSOR_CPU> (u32 addr)
+{
+    return config.stats ? cpuPeek16 <true> (addr) : cpuPeek16 <false> (addr);
+}
     
 template<> u16
 Memory::spypeek16 <ACCESSOR_CPU> (u32 addr) const
@@ -1441,9 +1719,31 @@ template <> void
 Memory::spypeek <ACCESSOR_CPU> (u32 addr, isize len, u8 *buf) const
 {
     assert(buf);
-    
-    for (isize i = 0; i < len; i++) {
-        buf[i] = spypeek8 <ACCESSOR_CPU> (u32(addr + i));
+
+    while (len > 0) {
+
+        addr &= 0xFFFFFF;
+        isize span;
+
+        if (u8 *src = hostPtr(addr, span)) {
+
+            // Copy a contiguous block of Ram or Rom
+            span = std::min(span, len);
+            std::memcpy(buf, src, span);
+
+        } else {
+
+            // Read byte by byte up to the end of the current bank
+            span = std::min(isize(0x10000 - (addr & 0xFFFF)), len);
+
+            for (isize i = 0; i < span; i++) {
+                buf[i] = spypeek8 <ACCESSOR_CPU> (u32(addr + i));
+            }
+        }
+
+        addr += u32(span);
+        buf += span;
+        len -= span;
     }
 }
 
@@ -1470,6 +1770,7 @@ template<> u16
 Memory::peek16 <ACCESSOR_AGNUS, MEM_CHIP> (u32 addr)
 {
     assert((addr & agnus.ptrMask) == addr);
+    blitter.willReadChip(addr);
     dataBus = READ_CHIP_16(addr);
     return dataBus;
 }
@@ -1559,8 +1860,8 @@ Memory::poke8 <ACCESSOR_CPU, MEM_CHIP> (u32 addr, u8 value)
     }
 
     agnus.executeUntilBusIsFree();
+    blitter.willWriteChip(addr);
     
-    stats.chipWrites.raw++;
     dataBus = value;
     WRITE_CHIP_8(addr, value);
 }
@@ -1577,8 +1878,8 @@ Memory::poke16 <ACCESSOR_CPU, MEM_CHIP> (u32 addr, u16 value)
     }
 
     agnus.executeUntilBusIsFree();
+    blitter.willWriteChip(addr);
     
-    stats.chipWrites.raw++;
     dataBus = value;
     WRITE_CHIP_16(addr, value);
 }
@@ -1590,7 +1891,6 @@ Memory::poke8 <ACCESSOR_CPU, MEM_SLOW> (u32 addr, u8 value)
     
     agnus.executeUntilBusIsFree();
     
-    stats.slowWrites.raw++;
     dataBus = value;
     WRITE_SLOW_8(addr, value);
 }
@@ -1602,7 +1902,6 @@ Memory::poke16 <ACCESSOR_CPU, MEM_SLOW> (u32 addr, u16 value)
     
     agnus.executeUntilBusIsFree();
     
-    stats.slowWrites.raw++;
     dataBus = value;
     WRITE_SLOW_16(addr, value);
 }
@@ -1612,7 +1911,6 @@ Memory::poke8 <ACCESSOR_CPU, MEM_FAST> (u32 addr, u8 value)
 {
     ASSERT_FAST_ADDR(addr);
     
-    stats.fastWrites.raw++;
     WRITE_FAST_8(addr, value);
 }
 
@@ -1621,7 +1919,6 @@ Memory::poke16 <ACCESSOR_CPU, MEM_FAST> (u32 addr, u16 value)
 {
     ASSERT_FAST_ADDR(addr);
     
-    stats.fastWrites.raw++;
     WRITE_FAST_16(addr, value);
 }
 
@@ -1731,8 +2028,6 @@ Memory::poke8 <ACCESSOR_CPU, MEM_ROM> (u32 addr, u8 value)
 {
     ASSERT_ROM_ADDR(addr);
     
-    stats.kickWrites.raw++;
-    
     // On Amigas with a WOM, writing into ROM space locks the WOM
     if (hasWom() && !womIsLocked) {
         debug(MEM_DEBUG, "Locking WOM\n");
@@ -1752,7 +2047,6 @@ Memory::poke8 <ACCESSOR_CPU, MEM_WOM> (u32 addr, u8 value)
 {
     ASSERT_WOM_ADDR(addr);
     
-    stats.kickWrites.raw++;
     if (!womIsLocked) WRITE_WOM_8(addr, value);
 }
 
@@ -1761,7 +2055,6 @@ Memory::poke16 <ACCESSOR_CPU, MEM_WOM> (u32 addr, u16 value)
 {
     ASSERT_WOM_ADDR(addr);
 
-    stats.kickWrites.raw++;
     if (!womIsLocked) WRITE_WOM_16(addr, value);
 }
 
@@ -1769,19 +2062,28 @@ template <> void
 Memory::poke8 <ACCESSOR_CPU, MEM_EXT> (u32 addr, u8 value)
 {
     ASSERT_EXT_ADDR(addr);
-    stats.kickWrites.raw++;
 }
 
 template <> void
 Memory::poke16 <ACCESSOR_CPU, MEM_EXT> (u32 addr, u16 value)
 {
     ASSERT_EXT_ADDR(addr);
-    stats.kickWrites.raw++;
 }
 
-template<> void
-Memory::poke8 <ACCESSOR_CPU> (u32 addr, u8 value)
+template <bool track> void
+Memory::cpuPoke8(u32 addr, u8 value)
 {
+    // Fast path: Access the host memory directly if possible
+    if (auto &page = cpuWritePtr[(addr & 0xFFFFFF) >> 16]; page.base) {
+
+        if constexpr (track) (*page.counter)++;
+        W8BE(page.base + (addr & 0xFFFF), value);
+        return;
+    }
+
+    heatmap.write <HEAT_CPU> (addr);
+    if constexpr (track) countWrite(cpuMemSrc[(addr & 0xFFFFFF) >> 16]);
+
     switch (cpuMemSrc[(addr & 0xFFFFFF) >> 16]) {
             
         case MEM_NONE:          poke8 <ACCESSOR_CPU, MEM_NONE>     (addr, value); return;
@@ -1807,8 +2109,29 @@ Memory::poke8 <ACCESSOR_CPU> (u32 addr, u8 value)
 }
 
 template<> void
-Memory::poke16 <ACCESSOR_CPU> (u32 addr, u16 value)
+Memory::poke8 <ACCESSOR_CPU> (u32 addr, u8 value)
+{
+    if (config.stats) {
+        cpuPoke8 <true> (addr, value);
+    } else {
+        cpuPoke8 <false> (addr, value);
+    }
+}
+
+template <bool track> void
+Memory::cpuPoke16(u32 addr, u16 value)
 {
+    // Fast path: Access the host memory directly if possible
+    if (auto &page = cpuWritePtr[(addr & 0xFFFFFF) >> 16]; page.base) {
+
+        if constexpr (track) (*page.counter)++;
+        W16BE(page.base + (addr & 0xFFFF), value);
+        return;
+    }
+
+    heatmap.write <HEAT_CPU> (addr);
+    if constexpr (track) countWrite(cpuMemSrc[(addr & 0xFFFFFF) >> 16]);
+
     switch (cpuMemSrc[(addr & 0xFFFFFF) >> 16]) {
             
         case MEM_NONE:          poke16 <ACCESSOR_CPU, MEM_NONE>     (addr, value); return;
@@ -1833,6 +2156,54 @@ Memory::poke16 <ACCESSOR_CPU> (u32 addr, u16 value)
     }
 }
 
+template<> void
+Memory::poke16 <ACCESSOR_CPU> (u32 addr, u16 value)
+{
+    if (config.stats) {
+        cpuPoke16 <true> (addr, value);
+    } else {
+        cpuPoke16 <false> (addr, value);
+    }
+}
+
+void
+Memory::countRead(MemorySource src)
+{
+    switch (src) {
+
+        case MEM_CHIP:
+        case MEM_CHIP_MIRROR:   stats.chipReads.raw++; break;
+        case MEM_SLOW:          stats.slowReads.raw++; break;
+        case MEM_FAST:          stats.fastReads.raw++; break;
+        case MEM_ROM:
+        case MEM_ROM_MIRROR:
+        case MEM_WOM:
+        case MEM_EXT:           stats.kickReads.raw++; break;
+
+        default:
+            break;
+    }
+}
+
+void
+Memory::countWrite(MemorySource src)
+{
+    switch (src) {
+
+        case MEM_CHIP:
+        case MEM_CHIP_MIRROR:   stats.chipWrites.raw++; break;
+        case MEM_SLOW:          stats.slowWrites.raw++; break;
+        case MEM_FAST:          stats.fastWrites.raw++; break;
+        case MEM_ROM:
+        case MEM_ROM_MIRROR:
+        case MEM_WOM:
+        case MEM_EXT:           stats.kickWrites.raw++; break;
+
+        default:
+            break;
+    }
+}
+
 //
 // Poke (Agnus)
 //
@@ -1848,6 +2219,7 @@ template <> void
 Memory::poke16 <ACCESSOR_AGNUS, MEM_CHIP> (u32 addr, u16 value)
 {
     assert((addr & agnus.ptrMask) == addr);
+    blitter.willWriteChip(addr);
 
     dataBus = value;
     WRITE_CHIP_16(addr, value);
@@ -2052,9 +2424,12 @@ Memory::peekCustom16(u32 addr)
 {
     u16 result;
 
+    histogram.read(addr);
+
     switch ((addr >> 1) & 0xFF) {
 
         case 0x002 >> 1: // DMACONR
+            blitter.finishAsyncBlit();
             result = agnus.peekDMACONR(); break;
         case 0x004 >> 1: // VPOSR
             result = agnus.peekVPOSR(); break;
@@ -2174,6 +2549,7 @@ Memory::pokeCustom16(u32 addr, u16 value)
     }
 
     dataBus = value;
+    histogram.write <s> (addr);
 
     switch ((addr >> 1) & 0xFF) {
 
@@ -2634,6 +3010,7 @@ template <> void
 Memory::patch <MEM_CHIP> (u32 addr, u8 value)
 {
     ASSERT_CHIP_ADDR(addr);
+    blitter.willWriteChip(addr);
     WRITE_CHIP_8(addr, value);
 }
 
@@ -2710,13 +3087,125 @@ Memory::patch(u32 addr, u32 value)
 }
 
 void
-Memory::patch(u32 addr, u8 *buf, isize len)
+Memory::patch(u32 addr, const u8 *buf, isize len)
 {
     assert(buf);
-    
-    for (isize i = 0; i < len; i++) {
-        patch(u32(addr + i), buf[i]);
+
+    // The block might overlap the area of an asynchronous blit
+    blitter.finishAsyncBlit();
+
+    while (len > 0) {
+
+        addr &= 0xFFFFFF;
+        isize span;
+
+        // Allocate the Slow Ram or Fast Ram page to be written into
+        switch (cpuMemSrc[addr >> 16]) {
+
+            case MEM_SLOW: ramWritePtr(slowPages, addr - SLOW_RAM_STRT); break;
+            case MEM_FAST: ramWritePtr(fastPages, addr - FAST_RAM_STRT); break;
+
+            default:
+                break;
+        }
+
+        if (u8 *dst = hostPtr(addr, span)) {
+
+            // Copy a contiguous block of Ram or Rom
+            span = std::min(span, len);
+            std::memcpy(dst, buf, span);
+
+        } else {
+
+            // Write word by word up to the end of the current bank
+            span = std::min(isize(0x10000 - (addr & 0xFFFF)), len);
+
+            for (isize i = 0; i < span; ) {
+
+                auto a = u32(addr + i);
+
+                if (IS_EVEN(a) && i + 1 < span) {
+
+                    poke16 <ACCESSOR_CPU> (a, HI_LO(buf[i], buf[i + 1]));
+                    i += 2;
+
+                } else {
+
+                    poke8 <ACCESSOR_CPU> (a, buf[i]);
+                    i += 1;
+                }
+            }
+        }
+
+        addr += u32(span);
+        buf += span;
+        len -= span;
+    }
+}
+
+u8 *
+Memory::hostPtr(u32 addr, isize &len) const
+{
+    addr &= 0xFFFFFF;
+
+    // Never cross a bank boundary
+    len = 0x10000 - (addr & 0xFFFF);
+
+    u8 *result;
+    isize avail;
+
+    switch (cpuMemSrc[addr >> 16]) {
+
+        case MEM_CHIP:
+        case MEM_CHIP_MIRROR:
+
+            result = chip + (addr & chipMask);
+            avail = config.chipSize - (addr & chipMask);
+            break;
+
+        case MEM_SLOW:
+
+            result = slowPages[(addr - SLOW_RAM_STRT) / ramPageSize].ptr;
+            if (!result) { len = 0; return nullptr; }
+            result += (addr - SLOW_RAM_STRT) % ramPageSize;
+            avail = config.slowSize - (addr - SLOW_RAM_STRT);
+            break;
+
+        case MEM_FAST:
+
+            result = fastPages[(addr - FAST_RAM_STRT) / ramPageSize].ptr;
+            if (!result) { len = 0; return nullptr; }
+            result += (addr - FAST_RAM_STRT) % ramPageSize;
+            avail = config.fastSize - (addr - FAST_RAM_STRT);
+            break;
+
+        case MEM_ROM:
+        case MEM_ROM_MIRROR:
+
+            result = rom + (addr & romMask);
+            avail = config.romSize - (addr & romMask);
+            break;
+
+        case MEM_WOM:
+
+            result = wom + (addr & womMask);
+            avail = config.womSize - (addr & womMask);
+            break;
+
+        case MEM_EXT:
+
+            result = ext + (addr & extMask);
+            avail = config.extSize - (addr & extMask);
+            break;
+
+        default:
+
+            len = 0;
+            return nullptr;
     }
+
+    len = std::min(len, avail);
+    return result;
 }
 
 const char *
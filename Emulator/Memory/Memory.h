@@ -11,6 +11,8 @@
 
 #include "MemoryTypes.h"
 #include "SubComponent.h"
+#include "Heatmap.h"
+#include "RegisterHistogram.h"
 #include "RomFileTypes.h"
 #include "MemUtils.h"
 
@@ -54,12 +56,12 @@ assert((x) >= 0xE80000 && (x) <= 0xE8FFFF);
 #define READ_CHIP_16(x)     R16BE(chip + ((x) & chipMask))
 
 // Reads a value from Fast RAM in big endian format
-#define READ_FAST_8(x)      R8BE (fast + ((x) - FAST_RAM_STRT))
-#define READ_FAST_16(x)     R16BE(fast + ((x) - FAST_RAM_STRT))
+#define READ_FAST_8(x)      R8BE (ramReadPtr(fastPages, (x) - FAST_RAM_STRT))
+#define READ_FAST_16(x)     R16BE(ramReadPtr(fastPages, (x) - FAST_RAM_STRT))
 
 // Reads a value from Slow RAM in big endian format
-#define READ_SLOW_8(x)      R8BE (slow + ((x) - SLOW_RAM_STRT))
-#define READ_SLOW_16(x)     R16BE(slow + ((x) - SLOW_RAM_STRT))
+#define READ_SLOW_8(x)      R8BE (ramReadPtr(slowPages, (x) - SLOW_RAM_STRT))
+#define READ_SLOW_16(x)     R16BE(ramReadPtr(slowPages, (x) - SLOW_RAM_STRT))
 
 // Reads a value from Boot ROM or Kickstart ROM in big endian format
 #define READ_ROM_8(x)       R8BE (rom + ((x) & romMask))
@@ -82,12 +84,12 @@ assert((x) >= 0xE80000 && (x) <= 0xE8FFFF);
 #define WRITE_CHIP_16(x,y)  W16BE(chip + ((x) & chipMask), (y))
 
 // Writes a value into Fast RAM in big endian format
-#define WRITE_FAST_8(x,y)   W8BE (fast + ((x) - FAST_RAM_STRT), (y))
-#define WRITE_FAST_16(x,y)  W16BE(fast + ((x) - FAST_RAM_STRT), (y))
+#define WRITE_FAST_8(x,y)   W8BE (ramWritePtr(fastPages, (x) - FAST_RAM_STRT), (y))
+#define WRITE_FAST_16(x,y)  W16BE(ramWritePtr(fastPages, (x) - FAST_RAM_STRT), (y))
 
 // Writes a value into Slow RAM in big endian format
-#define WRITE_SLOW_8(x,y)   W8BE (slow + ((x) - SLOW_RAM_STRT), (y))
-#define WRITE_SLOW_16(x,y)  W16BE(slow + ((x) - SLOW_RAM_STRT), (y))
+#define WRITE_SLOW_8(x,y)   W8BE (ramWritePtr(slowPages, (x) - SLOW_RAM_STRT), (y))
+#define WRITE_SLOW_16(x,y)  W16BE(ramWritePtr(slowPages, (x) - SLOW_RAM_STRT), (y))
 
 // Writes a value into Boot ROM or Kickstart ROM in big endian format
 #define WRITE_ROM_8(x,y)    W8BE (rom + ((x) & romMask), (y))
@@ -154,20 +156,31 @@ public:
      *    pointer == nullptr <=> config.size == 0 <=> mask == 0
      *    pointer != nullptr <=> mask == config.size - 1
      *
+     * Slow Ram and Fast Ram are an exception. They are represented by a page
+     * table instead of a pointer (see below).
      */
     u8 *rom;
     u8 *wom;
     u8 *ext;
     u8 *chip;
-    u8 *slow;
-    u8 *fast;
 
     Allocator<u8> romAllocator = Allocator(rom);
     Allocator<u8> womAllocator = Allocator(wom);
     Allocator<u8> extAllocator = Allocator(ext);
     Allocator<u8> chipAllocator = Allocator(chip);
-    Allocator<u8> slowAllocator = Allocator(slow);
-    Allocator<u8> fastAllocator = Allocator(fast);
+
+    /* Slow Ram and Fast Ram are backed by page tables. Each page covers a
+     * single memory bank and is allocated when it is written to for the
+     * first time. Reads from an unallocated page return zero. Hence, Ram
+     * which is never touched by the guest occupies no host memory and is
+     * omitted in snapshots.
+     */
+    static constexpr isize ramPageSize = KB(64);
+    Buffer<u8> slowPages[KB(512) / ramPageSize];
+    Buffer<u8> fastPages[MB(8) / ramPageSize];
+
+    // Backs all reads from unallocated pages
+    static const u8 zeroPage[ramPageSize];
 
     u32 romMask = 0;
     u32 womMask = 0;
@@ -189,9 +202,27 @@ public:
     MemorySource cpuMemSrc[256];
     MemorySource agnusMemSrc[256];
 
+    /* Direct page pointers. If the CPU can access a bank without any side
+     * effect other than updating the statistics, the tables below point to
+     * the host memory backing this bank and to the statistics counter to
+     * increment. This allows peek and poke to bypass the memory source switch
+     * for the most frequent accesses. All other banks are marked with nullptr.
+     * The tables are derived from cpuMemSrc.
+     * See also: updateCpuPagePtrs()
+     */
+    struct PagePtr { u8 *base; isize *counter; };
+    PagePtr cpuReadPtr[256] = { };
+    PagePtr cpuWritePtr[256] = { };
+
     // The last value on the data bus
     u16 dataBus;
 
+    // Per-page access counters (disabled by default)
+    Heatmap heatmap;
+
+    // Per-register access counters (disabled by default)
+    RegisterHistogram histogram;
+
     // Static buffer for returning textual representations
     char str[256];
     
@@ -223,6 +254,8 @@ private:
     
     void _initialize() override;
     void _reset(bool hard) override;
+    void _didLoad() override;
+    isize _memoryFootprint() const override;
     
     template <class T>
     void applyToPersistentItems(T& worker)
@@ -315,6 +348,7 @@ private:
     
     void alloc(Allocator<u8> &allocator, isize bytes, bool update);
     void alloc(Allocator<u8> &allocator, isize bytes, u32 &mask, bool update);
+    template <isize N> void alloc(Buffer<u8> (&pages)[N], i32 &size, i32 bytes, bool update);
 
 
     //
@@ -325,8 +359,8 @@ public:
 
     // Check if a certain Ram is present
     bool hasChipRam() const { return chip != nullptr; }
-    bool hasSlowRam() const { return slow != nullptr; }
-    bool hasFastRam() const { return fast != nullptr; }
+    bool hasSlowRam() const { return config.slowSize != 0; }
+    bool hasFastRam() const { return config.fastSize != 0; }
 
     // Returns the size of a certain Ram in bytes
     isize chipRamSize() const { return config.chipSize; }
@@ -334,10 +368,38 @@ public:
     isize fastRamSize() const { return config.fastSize; }
     isize ramSize() const { return config.chipSize + config.slowSize + config.fastSize; }
 
+    // Returns the number of allocated pages of Slow Ram or Fast Ram
+    isize usedPages(const Buffer<u8> *pages, isize size) const;
+
 private:
     
     void fillRamWithInitPattern();
 
+    // Returns a pointer to a byte of Slow Ram or Fast Ram for reading
+    const u8 *ramReadPtr(const Buffer<u8> *pages, u32 offset) const {
+
+        auto page = pages[offset / ramPageSize].ptr;
+        return (page ? page : zeroPage) + offset % ramPageSize;
+    }
+
+    // Returns a pointer to a byte of Slow Ram or Fast Ram for writing
+    u8 *ramWritePtr(Buffer<u8> *pages, u32 offset) {
+
+        auto &page = pages[offset / ramPageSize];
+        if (!page.ptr) allocPage(page);
+        return page.ptr + offset % ramPageSize;
+    }
+
+    // Allocates a zeroed page of Slow Ram or Fast Ram
+    void allocPage(Buffer<u8> &page);
+
+    // Frees all pages of Slow Ram or Fast Ram
+    template <isize N> void freePages(Buffer<u8> (&pages)[N]);
+
+    // Saves or restores the allocated pages of Slow Ram or Fast Ram
+    void saveSparse(util::SerWriter &writer, const Buffer<u8> *pages, isize size);
+    void loadSparse(util::SerReader &reader, Buffer<u8> *pages, isize size) throws;
+
     
     //
     // Managing ROM
@@ -418,10 +480,33 @@ public:
     bool inRom(u32 addr);
 
     
+    //
+    // Recording the access heatmap
+    //
+
+public:
+
+    // Starts or stops recording
+    void startHeatmap() throws;
+    void stopHeatmap();
+
+
+    //
+    // Recording custom register accesses
+    //
+
+public:
+
+    // Starts or stops recording
+    void startHistogram();
+    void stopHistogram();
+
+    
 private:
 
     void updateCpuMemSrcTable();
     void updateAgnusMemSrcTable();
+    void updateCpuPagePtrs();
 
     
     //
@@ -430,6 +515,10 @@ private:
     
 public:
 
+    /* Spy accesses have no side effects. They don't wait for an asynchronous
+     * blit to finish (see Blitter.h). Hence, the destination area of such a
+     * blit holds intermediate data if they are issued inside the run loop.
+     */
     template <Accessor acc, MemorySource src> u8 peek8(u32 addr);
     template <Accessor acc, MemorySource src> u16 peek16(u32 addr);
     template <Accessor acc, MemorySource src> u8 spypeek8(u32 addr) const;
@@ -446,6 +535,23 @@ public:
     template <Accessor acc, MemorySource src> void poke16(u32 addr, u16 value);
     template <Accessor acc> void poke8(u32 addr, u8 value);
     template <Accessor acc> void poke16(u32 addr, u16 value);
+
+private:
+
+    /* CPU access dispatchers. The CPU variants of peek and poke forward to
+     * one of two instances, depending on whether statistics are recorded. In
+     * the instance without statistics, all counter updates are compiled out.
+     */
+    template <bool track> u8 cpuPeek8(u32 addr);
+    template <bool track> u16 cpuPeek16(u32 addr);
+    template <bool track> void cpuPoke8(u32 addr, u8 value);
+    template <bool track> void cpuPoke16(u32 addr, u16 value);
+
+    // Updates the statistics counters for a CPU access
+    void countRead(MemorySource src);
+    void countWrite(MemorySource src);
+
+public:
     
 
     //
@@ -494,7 +600,23 @@ public:
     void patch(u32 addr, u8 value);
     void patch(u32 addr, u16 value);
     void patch(u32 addr, u32 value);
-    void patch(u32 addr, u8 *buf, isize len);
+
+    /* Copies a memory block into the Amiga address space. The block is split
+     * into spans of contiguous host memory which are copied with memcpy.
+     * Areas not backed by Ram or Rom (custom chips, CIAs, autoconfig space)
+     * are written word by word through the CPU address decoder.
+     */
+    void patch(u32 addr, const u8 *buf, isize len);
+
+private:
+
+    /* Returns a pointer to the host memory that backs the specified address
+     * as seen by the CPU, together with the number of bytes that can be
+     * accessed from there in one go. Returns nullptr if the address is not
+     * backed by Ram or Rom, or if it belongs to an unallocated page of Slow
+     * Ram or Fast Ram.
+     */
+    u8 *hostPtr(u32 addr, isize &len) const;
 
     
     //
@@ -100,6 +100,48 @@ struct AccessorEnum : util::Reflection<AccessorEnum, Accessor>
 };
 #endif
 
+enum_long(HEAT_CLIENT)
+{
+    HEAT_CPU,
+    HEAT_DISK,
+    HEAT_COPPER,
+    HEAT_BLITTER,
+    HEAT_BITPLANE,
+    HEAT_SPRITE,
+    HEAT_AUDIO,
+    HEAT_DEBUGGER,
+    
+    HEAT_COUNT
+};
+typedef HEAT_CLIENT HeatClient;
+
+#ifdef __cplusplus
+struct HeatClientEnum : util::Reflection<HeatClientEnum, HeatClient>
+{
+    static constexpr long minVal = 0;
+    static constexpr long maxVal = HEAT_DEBUGGER;
+    static bool isValid(auto val) { return val >= minVal && val <= maxVal; }
+
+    static const char *prefix() { return "HEAT"; }
+    static const char *key(HeatClient value)
+    {
+        switch (value) {
+                
+            case HEAT_CPU:       return "CPU";
+            case HEAT_DISK:      return "DISK";
+            case HEAT_COPPER:    return "COPPER";
+            case HEAT_BLITTER:   return "BLITTER";
+            case HEAT_BITPLANE:  return "BITPLANE";
+            case HEAT_SPRITE:    return "SPRITE";
+            case HEAT_AUDIO:     return "AUDIO";
+            case HEAT_DEBUGGER:  return "DEBUGGER";
+            case HEAT_COUNT:     return "???";
+        }
+        return "???";
+    }
+};
+#endif
+
 enum_long(BANK_MAP)
 {
     BANK_MAP_A500,
@@ -222,6 +264,9 @@ typedef struct
     
     // Specifies how to deal with unmapped memory
     UnmappedMemory unmappingType;
+
+    // Indicates if access statistics are recorded
+    bool stats;
 }
 MemoryConfig;
 
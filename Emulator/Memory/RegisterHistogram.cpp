@@ -0,0 +1,117 @@
+// -----------------------------------------------------------------------------
+// This file is part of vAmiga
+//
+// Copyright (C) Dirk W. Hoffmann. www.dirkwhoffmann.de
+// Licensed under the GNU General Public License v3
+//
+// See https://www.gnu.org for license information
+// -----------------------------------------------------------------------------
+
+#include "config.h"
+#include "RegisterHistogram.h"
+#include "Memory.h"
+#include "IOUtils.h"
+#include <algorithm>
+
+void
+RegisterHistogram::start()
+{
+    current.assign(tableSize, 0);
+    latest.assign(tableSize, 0);
+    total.assign(tableSize, 0);
+    peak.assign(regCount, 0);
+    frames = 0;
+
+    enabled = true;
+}
+
+void
+RegisterHistogram::stop()
+{
+    enabled = false;
+}
+
+void
+RegisterHistogram::clear()
+{
+    std::fill(current.begin(), current.end(), 0);
+    std::fill(latest.begin(), latest.end(), 0);
+    std::fill(total.begin(), total.end(), 0);
+    std::fill(peak.begin(), peak.end(), 0);
+    frames = 0;
+}
+
+void
+RegisterHistogram::eofHandler()
+{
+    if (!enabled) return;
+
+    for (isize i = 0; i < tableSize; i++) total[i] += current[i];
+
+    for (isize r = 0; r < regCount; r++) {
+
+        u32 sum = 0;
+        for (isize t = 0; t < TYPE_COUNT; t++) sum += current[t * regCount + r];
+        peak[r] = std::max(peak[r], sum);
+    }
+
+    std::swap(current, latest);
+    std::fill(current.begin(), current.end(), 0);
+    frames++;
+}
+
+isize
+RegisterHistogram::footprint() const
+{
+    return isize(current.capacity() * sizeof(u32) +
+                 latest.capacity() * sizeof(u32) +
+                 total.capacity() * sizeof(u64) +
+                 peak.capacity() * sizeof(u32));
+}
+
+void
+RegisterHistogram::dump(std::ostream& os, isize count) const
+{
+    using namespace util;
+
+    os << tab("Recording");
+    os << bol(enabled) << std::endl;
+    os << tab("Frames");
+    os << dec(frames) << std::endl;
+
+    if (frames == 0) return;
+
+    // Collect all registers that have been accessed
+    std::vector<std::pair<u64, isize>> regs;
+
+    for (isize r = 0; r < regCount; r++) {
+
+        u64 sum = 0;
+        for (isize t = 0; t < TYPE_COUNT; t++) sum += total[t * regCount + r];
+        if (sum) regs.push_back( { sum, r } );
+    }
+
+    // Sort them by frequency
+    std::sort(regs.begin(), regs.end(), std::greater<>());
+
+    os << std::endl;
+    os << tab("Accesses per frame");
+    os << "     Reads  CPU writes  Cop writes      Latest        Peak" << std::endl;
+
+    for (isize i = 0; i < std::min(isize(regs.size()), count); i++) {
+
+        auto r = regs[i].second;
+        auto average = [&](isize type) {
+            return double(total[type * regCount + r]) / double(frames);
+        };
+        u32 last = 0;
+        for (isize t = 0; t < TYPE_COUNT; t++) last += latest[t * regCount + r];
+
+        char line[80];
+        snprintf(line, sizeof(line), "%10.1f  %10.1f  %10.1f  %10u  %10u",
+                 average(READ), average(CPU_WRITE), average(COPPER_WRITE),
+                 last, peak[r]);
+
+        os << tab(Memory::regName(u32(r << 1))) << line << std::endl;
+    }
+}
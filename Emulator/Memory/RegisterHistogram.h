@@ -0,0 +1,111 @@
+// -----------------------------------------------------------------------------
+// This file is part of vAmiga
+//
+// Copyright (C) Dirk W. Hoffmann. www.dirkwhoffmann.de
+// Licensed under the GNU General Public License v3
+//
+// See https://www.gnu.org for license information
+// -----------------------------------------------------------------------------
+
+#pragma once
+
+#include "MemoryTypes.h"
+#include <vector>
+
+/* The register histogram counts the accesses to each custom register. Reads
+ * are counted separately from writes, and writes are split up into writes
+ * issued by the CPU and writes issued by the Copper. Like the heatmap, the
+ * histogram keeps the counters of the latest completed frame and the
+ * counters accumulated over all frames. In addition, it records the maximum
+ * number of accesses a register has seen in a single frame, which exposes
+ * registers the emulated program is spinning on.
+ *
+ * The histogram is disabled by default. In this state, the counter tables
+ * are not allocated and the recording functions reduce to a single check of
+ * the enable flag.
+ */
+
+class RegisterHistogram {
+
+public:
+
+    // Number of custom registers
+    static constexpr isize regCount = 256;
+
+    // Access types
+    enum { READ, CPU_WRITE, COPPER_WRITE, TYPE_COUNT };
+
+    // Number of counters per table
+    static constexpr isize tableSize = TYPE_COUNT * regCount;
+
+private:
+
+    // Indicates if accesses are recorded
+    bool enabled = false;
+
+    // Access counters of the current frame
+    std::vector<u32> current;
+
+    // Access counters of the latest completed frame
+    std::vector<u32> latest;
+
+    // Access counters accumulated over all completed frames
+    std::vector<u64> total;
+
+    // Highest number of accesses per register seen in a single frame
+    std::vector<u32> peak;
+
+    // Number of completed frames
+    i64 frames = 0;
+
+
+    //
+    // Controlling
+    //
+
+public:
+
+    // Starts recording (all counters are cleared)
+    void start();
+
+    // Stops recording (the recorded data is kept)
+    void stop();
+
+    // Clears all counters
+    void clear();
+
+    // Returns true if accesses are recorded
+    bool isEnabled() const { return enabled; }
+
+    // Returns the number of completed frames
+    i64 numFrames() const { return frames; }
+
+    // Returns the number of bytes allocated for the counter tables
+    isize footprint() const;
+
+    // Prints the registers sorted by the number of accesses
+    void dump(std::ostream& os, isize count = 32) const;
+
+
+    //
+    // Recording
+    //
+
+public:
+
+    void read(u32 addr) {
+        if (enabled) current[index(READ, addr)]++;
+    }
+    template <Accessor A> void write(u32 addr) {
+        if (enabled) current[index(A == ACCESSOR_CPU ? CPU_WRITE : COPPER_WRITE, addr)]++;
+    }
+
+    // Finishes the current frame
+    void eofHandler();
+
+private:
+
+    static isize index(isize type, u32 addr) {
+        return type * regCount + ((addr >> 1) & 0xFF);
+    }
+};
@@ -9,8 +9,10 @@
 
 #include "config.h"
 #include "OSDebugger.h"
+#include "CPU.h"
 #include "IOUtils.h"
 #include "Memory.h"
+#include "Thread.h"
 #include <sstream>
 
 using namespace os;
@@ -481,3 +483,70 @@ OSDebugger::checkExecBase(const os::ExecBase &execBase) const
         }
     }
 }
+
+void
+OSDebugger::startProfiling()
+{
+    {   SUSPENDED
+        
+        usage.clear();
+        runningTask = thisTask();
+        recordTaskName(runningTask);
+        profileStart = profileSample = cpu.getCpuClock();
+        profiling = true;
+    }
+}
+
+void
+OSDebugger::stopProfiling()
+{
+    {   SUSPENDED
+        
+        eolHandler();
+        profiling = false;
+    }
+}
+
+void
+OSDebugger::eolHandler()
+{
+    // Only proceed if task profiling has been turned on
+    if (!profiling) return;
+    
+    auto clock = cpu.getCpuClock();
+    auto task = thisTask();
+    
+    // Attribute all cycles since the latest sample to the running task
+    usage[runningTask].cycles += clock - profileSample;
+    profileSample = clock;
+    
+    // Check for a context switch
+    if (task != runningTask) {
+        
+        recordTaskName(task);
+        usage[task].switches++;
+        runningTask = task;
+    }
+}
+
+u32
+OSDebugger::thisTask() const
+{
+    auto execBase = mem.spypeek32 <ACCESSOR_CPU> (4);
+    
+    if (!IS_EVEN(execBase) || !mem.inRam(execBase)) return 0;
+    return mem.spypeek32 <ACCESSOR_CPU> (execBase + 276);
+}
+
+void
+OSDebugger::recordTaskName(u32 task)
+{
+    auto &entry = usage[task];
+    
+    if (entry.name.empty() && task && mem.inRam(task)) {
+        
+        os::Node node = { };
+        read(task, &node);
+        read(node.ln_Name, entry.name, 32);
+    }
+}
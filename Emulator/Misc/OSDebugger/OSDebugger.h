@@ -12,11 +12,28 @@
 #include "OSDebuggerTypes.h"
 #include "SubComponent.h"
 #include "Constants.h"
+#include <map>
 
 class OSDebugger : public SubComponent {
     
-private:
-    
+    //
+    // Profiling
+    //
+
+    // Indicates if the CPU usage is recorded per task
+    bool profiling = false;
+
+    // Recorded CPU usage, indexed by the address of the task structure
+    std::map <u32, TaskUsage> usage;
+
+    // The task that was running when the latest sample was taken
+    u32 runningTask = 0;
+
+    // CPU clock at profiling start and at the time of the latest sample
+    i64 profileStart = 0;
+    i64 profileSample = 0;
+
+
     //
     // Constructing
     //
@@ -209,4 +226,30 @@ public:
     void dumpProcess(std::ostream& s, u32 addr);
     void dumpProcess(std::ostream& s, const string &name);
     void dumpProcess(std::ostream& s, const os::Process &process, bool verbose);
+    
+    void dumpProfile(std::ostream& s);
+    
+    
+    //
+    // Profiling tasks
+    //
+    
+public:
+    
+    bool isProfiling() const { return profiling; }
+    
+    // Starts or stops recording the CPU usage per task
+    void startProfiling();
+    void stopProfiling();
+    
+    // Attributes the elapsed CPU cycles to the running task
+    void eolHandler();
+    
+private:
+    
+    // Returns the address of the running task by reading ExecBase::ThisTask
+    u32 thisTask() const;
+
+    // Records the name of a task if it hasn't been recorded yet
+    void recordTaskName(u32 task);
 };
@@ -12,6 +12,8 @@
 #include "IOUtils.h"
 #include "Memory.h"
 #include "Thread.h"
+#include <algorithm>
+#include <iomanip>
 #include <sstream>
 
 void
@@ -589,3 +591,41 @@ OSDebugger::dumpProcess(std::ostream& s, const os::Process &process, bool verbos
         }
     }
 }
+
+void
+OSDebugger::dumpProfile(std::ostream& s)
+{
+    {   SUSPENDED
+        
+        using namespace util;
+        
+        // Bring the profile up to date
+        eolHandler();
+        
+        auto total = profileSample - profileStart;
+        
+        s << tab("Recorded CPU cycles");
+        s << dec(total) << (profiling ? " (running)" : " (stopped)") << std::endl;
+        s << std::endl;
+        
+        // Sort tasks by the number of consumed cycles
+        std::vector <std::pair <u32, TaskUsage>> tasks(usage.begin(), usage.end());
+        std::sort(tasks.begin(), tasks.end(), [](auto &a, auto &b) {
+            return a.second.cycles > b.second.cycles;
+        });
+        
+        for (auto &[addr, entry] : tasks) {
+            
+            auto percentage = total ? 100.0 * double(entry.cycles) / double(total) : 0.0;
+            auto name = addr ? entry.name : "<none>";
+            
+            std::stringstream ss;
+            ss << hex(addr);
+            s << tab(ss.str());
+            s << std::left << std::setw(24) << name.substr(0, 23);
+            s << std::right << std::setw(12) << entry.cycles << " cycles ";
+            s << std::fixed << std::setprecision(1) << std::setw(6) << percentage << "% ";
+            s << std::setw(8) << entry.switches << " switches" << std::endl;
+        }
+    }
+}
@@ -435,3 +435,20 @@ typedef struct ExecBase
 ExecBase;
 
 }
+
+
+//
+// Profiling
+//
+
+struct TaskUsage
+{
+    // Name of the task (recorded when the task shows up for the first time)
+    string name;
+
+    // Number of CPU cycles spent while the task was running
+    i64 cycles = 0;
+
+    // Number of times the task has been switched in
+    isize switches = 0;
+};
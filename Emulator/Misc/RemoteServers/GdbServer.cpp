@@ -246,6 +246,7 @@ string
 GdbServer::readMemory(isize addr)
 {
     auto byte = mem.spypeek8 <ACCESSOR_CPU> ((u32)addr);
+    mem.heatmap.read <HEAT_DEBUGGER> ((u32)addr);
     return util::hexstr <2> (byte);
 }
 
@@ -300,7 +300,7 @@ Muxer::synthesize(Cycle clock, Cycle target, long count)
     // Determine the number of elapsed cycles per audio sample
     double cyclesPerSample = (double)(target - clock) / (double)count;
                 
-    switch (config.samplingMethod) {
+    switch (samplingMethod()) {
             
         case SMP_NONE:
             
@@ -333,7 +333,7 @@ Muxer::synthesize(Cycle clock, Cycle target)
     long count = (long)exact;
     fraction = exact - (double)count;
              
-    switch (config.samplingMethod) {
+    switch (samplingMethod()) {
         case SMP_NONE:
             
             synthesize <SMP_NONE> (clock, count, cyclesPerSample);
@@ -355,6 +355,12 @@ Muxer::synthesize(Cycle clock, Cycle target)
     }
 }
 
+SamplingMethod
+Muxer::samplingMethod() const
+{
+    return amiga.inReducedAccuracyMode() ? SMP_NONE : config.samplingMethod;
+}
+
 template <SamplingMethod method> void
 Muxer::synthesize(Cycle clock, long count, double cyclesPerSample)
 {
@@ -217,6 +217,9 @@ private:
 
     template <SamplingMethod method>
     void synthesize(Cycle clock, long count, double cyclesPerSample);
+
+    // Returns the sampling method to use (SMP_NONE if accuracy is reduced)
+    SamplingMethod samplingMethod() const;
     
     // Handles a buffer underflow or overflow condition
     void handleBufferUnderflow();
@@ -570,6 +570,7 @@ DiskController::performTurboRead(FloppyDrive *drive)
             check2 = util::fnvIt32(check2, agnus.dskpt & agnus.ptrMask);
         }
         mem.poke16 <ACCESSOR_AGNUS> (agnus.dskpt, word);
+        mem.heatmap.write <HEAT_DISK> (agnus.dskpt);
         agnus.dskpt += 2;
     }
     
@@ -590,6 +591,7 @@ DiskController::performTurboWrite(FloppyDrive *drive)
         
         // Read word from memory
         u16 word = mem.peek16 <ACCESSOR_AGNUS> (agnus.dskpt);
+        mem.heatmap.read <HEAT_DISK> (agnus.dskpt);
         
         if constexpr (DSK_CHECKSUM) {
             
@@ -186,6 +186,17 @@ FloppyDrive::_inspect() const
     }
 }
 
+isize
+FloppyDrive::_memoryFootprint() const
+{
+    isize result = 0;
+
+    if (disk) result += isizeof(FloppyDisk);
+    if (diskToInsert) result += isizeof(FloppyDisk);
+
+    return result;
+}
+
 void
 FloppyDrive::_dump(Category category, std::ostream& os) const
 {
@@ -110,6 +110,7 @@ private:
     
     void _reset(bool hard) override;
     void _inspect() const override;
+    isize _memoryFootprint() const override;
     
     template <class T>
     void applyToPersistentItems(T& worker)
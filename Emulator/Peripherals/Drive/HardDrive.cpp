@@ -321,6 +321,18 @@ HardDrive::_inspect() const
     }
 }
 
+isize
+HardDrive::_memoryFootprint() const
+{
+    isize result = data.bytesize();
+
+    result += isize(ptable.capacity() * sizeof(PartitionDescriptor));
+    result += isize(drivers.capacity() * sizeof(DriverDescriptor));
+    for (auto &driver : drivers) result += isize(driver.blocks.capacity() * sizeof(u32));
+
+    return result;
+}
+
 isize
 HardDrive::didLoadFromBuffer(const u8 *buffer)
 {
@@ -635,6 +647,7 @@ HardDrive::write(isize offset, isize length, u32 addr)
         if (!writeProtected) {
 
             // Perform the write operation
+            agnus.blitter.finishAsyncBlit();
             mem.spypeek <ACCESSOR_CPU> (addr, length, data.ptr + offset);
             
             // Handle write-through mode
@@ -17,27 +17,28 @@
 
 enum class Token
 {
-    about, accuracy, agnus, amiga, at, attach, audiate, audio, autofire,
-    autosync, bankmap, beam, bitplanes, blitter, bp, brightness, bullets,
+    about, accuracy, adaptive, agnus, amiga, async, at, attach, audiate, audio,
+    autofire, autosync, bankmap, beam, bitplanes, blitter, bp, brightness, bullets,
     callstack, channel, checksums, chip, cia, clear, close, clxsprspr,
     clxsprplf, clxplfplf, color, config, connect, contrast, controlport,
     copper, cp, cpu, cutout, dc, debug, defaults, delay, del, denise, detach,
     device, devices, dfn, diagboard, down, hdn, disable, disconnect, disk, dma,
     dmadebugger, drive, dsksync, easteregg, eject, enable, esync, events,
-    execbase, extrom, extstart, fast, filename, filesystem, filter, gdb,
-    geometry, help, hide, ignore, init, info, insert, inspect, interrupt,
-    interrupts, joystick, jump, keyboard, keyset, layers, left, library,
-    libraries, list, load, lock, mechanics, memory, mode, model, monitor,
-    mouse, none, ntsc, off, on, opacity, open, os, overclocking, pal, palette,
-    pan, partition, path, paula, pause, ptrdrops, poll, port, ports, power,
-    press, process, processes, pull, pullup, raminitpattern, refresh,
-    registers, regreset, regression, release, reset, resource, resources,
+    execbase, extrom, extstart, fast, filename, filesystem, filter, footprint,
+    gdb, geometry, heatmap, help, hide, histogram, ignore, init, info, insert,
+    inspect, interrupt, interrupts, joystick, jump, keyboard, keyset, layers,
+    left, library, libraries, list, load, lock, mechanics, memory, mode, model,
+    monitor, mouse, none, ntsc, off, on, opacity, open, os, overclocking, pal,
+    palette, pan, partition, path, paula, pause, ptrdrops, poll, port, ports,
+    power, press, process, processes, profile, pull, pullup, raminitpattern,
+    record, refresh, registers, regreset, regression, release, reset, resource, resources,
     revision, right, rom, rshell, rtc, run, sampling, saturation, save,
     saveroms, screenshot, searchpath, serial, server, set, setup, shakedetector,
     show, slow, slowramdelay, slowrammirror, source, speed, sprites, start,
-    state, status, step, stop, swapdelay, swtraps, task, tasks, tod, todbug,
-    tracking, trap, unmappingtype, up, vector, verbose, velocity,volume,
-    volumes, wait, watch, watchpoint, wom, wp, xaxis, yaxis, zorro
+    state, stats, status, step, stop, swapdelay, swtraps, task, tasks, timeline, tod,
+    todbug, trace, tracking, trap, unmappingtype, up, vector, verbose,
+    velocity,volume, volumes, wait, watch, watchpoint, wom, wp, xaxis, yaxis,
+    zorro
 };
 
 struct TooFewArgumentsError : public util::ParseError {
@@ -105,6 +105,10 @@ Interpreter::registerInstructions()
              "key", "Emulates a NTSC machine",
              &RetroShell::exec <Token::amiga, Token::set, Token::ntsc>, 0);
 
+    root.add({"amiga", "set", "adaptive"},
+             "key", "Reduces the emulation accuracy in warp mode",
+             &RetroShell::exec <Token::amiga, Token::set, Token::adaptive>, 1);
+
     root.add({"amiga", "init"},
              "command", "Initializes the Amiga with a predefined scheme",
              &RetroShell::exec <Token::amiga, Token::init>, 1);
@@ -153,6 +157,10 @@ Interpreter::registerInstructions()
     root.add({"amiga", "inspect", "defaults"},
              "command", "Displays the user defaults storage",
              &RetroShell::exec <Token::amiga, Token::inspect, Token::defaults>, 0);
+
+    root.add({"amiga", "inspect", "footprint"},
+             "command", "Displays the memory footprint of all components",
+             &RetroShell::exec <Token::amiga, Token::inspect, Token::footprint>, 0);
     
     
     //
@@ -204,6 +212,10 @@ Interpreter::registerInstructions()
     root.add({"memory", "set", "raminit"},
              "key", "Determines how Ram is initialized on startup",
              &RetroShell::exec <Token::memory, Token::set, Token::raminitpattern>, 1);
+
+    root.add({"memory", "set", "stats"},
+             "key", "Enables or disables access statistics",
+             &RetroShell::exec <Token::memory, Token::set, Token::stats>, 1);
     
     root.add({"memory", "load"},
              "command", "Installs a Rom image");
@@ -231,6 +243,48 @@ Interpreter::registerInstructions()
              "command", "Computes memory checksums",
              &RetroShell::exec <Token::memory, Token::inspect, Token::checksums>, 0);
 
+    root.add({"memory", "heatmap"},
+             "command", "Records memory accesses per page");
+
+    root.add({"memory", "heatmap", "start"},
+             "command", "Starts recording",
+             &RetroShell::exec <Token::memory, Token::heatmap, Token::start>, 0);
+
+    root.add({"memory", "heatmap", "stop"},
+             "command", "Stops recording",
+             &RetroShell::exec <Token::memory, Token::heatmap, Token::stop>, 0);
+
+    root.add({"memory", "heatmap", "clear"},
+             "command", "Clears all counters",
+             &RetroShell::exec <Token::memory, Token::heatmap, Token::clear>, 0);
+
+    root.add({"memory", "heatmap", "info"},
+             "command", "Displays a summary",
+             &RetroShell::exec <Token::memory, Token::heatmap, Token::info>, 0);
+
+    root.add({"memory", "heatmap", "save"},
+             "command", "Exports the latest frame or all frames (CSV or PGM)",
+             &RetroShell::exec <Token::memory, Token::heatmap, Token::save>, {1, 2});
+
+    root.add({"memory", "histogram"},
+             "command", "Records custom register accesses");
+
+    root.add({"memory", "histogram", "start"},
+             "command", "Starts recording",
+             &RetroShell::exec <Token::memory, Token::histogram, Token::start>, 0);
+
+    root.add({"memory", "histogram", "stop"},
+             "command", "Stops recording",
+             &RetroShell::exec <Token::memory, Token::histogram, Token::stop>, 0);
+
+    root.add({"memory", "histogram", "clear"},
+             "command", "Clears all counters",
+             &RetroShell::exec <Token::memory, Token::histogram, Token::clear>, 0);
+
+    root.add({"memory", "histogram", "info"},
+             "command", "Lists the most frequently accessed registers",
+             &RetroShell::exec <Token::memory, Token::histogram, Token::info>, {0, 1});
+
     
     //
     // CPU
@@ -370,6 +424,21 @@ Interpreter::registerInstructions()
              "command", "Jumps to the specified address",
              &RetroShell::exec <Token::cpu, Token::jump>, 1);
 
+    root.add({"cpu", "trace"},
+             "command", "Streams executed instructions into a file");
+
+    root.add({"cpu", "trace", "start"},
+             "command", "Starts tracing (optionally including register changes)",
+             &RetroShell::exec <Token::cpu, Token::trace, Token::start>, {1, 2});
+
+    root.add({"cpu", "trace", "stop"},
+             "command", "Stops tracing",
+             &RetroShell::exec <Token::cpu, Token::trace, Token::stop>, 0);
+
+    root.add({"cpu", "trace", "info"},
+             "command", "Displays tracing statistics",
+             &RetroShell::exec <Token::cpu, Token::trace, Token::info>, 0);
+
     
     //
     // CIA
@@ -489,6 +558,10 @@ Interpreter::registerInstructions()
              "level", "Selects the emulation accuracy level",
              &RetroShell::exec <Token::blitter, Token::set, Token::accuracy>, 1);
 
+    root.add({"blitter", "set", "async"},
+             "key", "Enables or disables asynchronous level 0 blits",
+             &RetroShell::exec <Token::blitter, Token::set, Token::async>, 1);
+
     root.add({"blitter", "inspect"},
              "command", "Displays the internal state");
 
@@ -500,6 +573,33 @@ Interpreter::registerInstructions()
              "category", "Displays the current register value",
              &RetroShell::exec <Token::blitter, Token::inspect, Token::registers>, 0);
 
+    root.add({"blitter", "inspect", "stats"},
+             "category", "Displays the minterm and worker thread statistics",
+             &RetroShell::exec <Token::blitter, Token::inspect, Token::stats>, 0);
+
+    root.add({"blitter", "trace"},
+             "command", "Records all blits");
+
+    root.add({"blitter", "trace", "start"},
+             "command", "Starts recording",
+             &RetroShell::exec <Token::blitter, Token::trace, Token::start>, 0);
+
+    root.add({"blitter", "trace", "stop"},
+             "command", "Stops recording",
+             &RetroShell::exec <Token::blitter, Token::trace, Token::stop>, 0);
+
+    root.add({"blitter", "trace", "clear"},
+             "command", "Deletes all records",
+             &RetroShell::exec <Token::blitter, Token::trace, Token::clear>, 0);
+
+    root.add({"blitter", "trace", "info"},
+             "command", "Displays a summary",
+             &RetroShell::exec <Token::blitter, Token::trace, Token::info>, 0);
+
+    root.add({"blitter", "trace", "save"},
+             "command", "Exports all records (CSV or binary trace)",
+             &RetroShell::exec <Token::blitter, Token::trace, Token::save>, 1);
+
     
     //
     // Copper
@@ -724,6 +824,40 @@ Interpreter::registerInstructions()
              "command", "Hides memory refresh cycles",
              &RetroShell::exec <Token::dmadebugger, Token::hide, Token::refresh>, 0);
 
+    root.add({"dmadebugger", "profile"},
+             "command", "Records bus utilization statistics");
+
+    root.add({"dmadebugger", "profile", "start"},
+             "command", "Starts recording",
+             &RetroShell::exec <Token::dmadebugger, Token::profile, Token::start>, 0);
+
+    root.add({"dmadebugger", "profile", "stop"},
+             "command", "Stops recording",
+             &RetroShell::exec <Token::dmadebugger, Token::profile, Token::stop>, 0);
+
+    root.add({"dmadebugger", "profile", "info"},
+             "command", "Displays a bus utilization report",
+             &RetroShell::exec <Token::dmadebugger, Token::profile, Token::info>, 0);
+
+    root.add({"dmadebugger", "profile", "save"},
+             "command", "Exports the per-line statistics (CSV)",
+             &RetroShell::exec <Token::dmadebugger, Token::profile, Token::save>, 1);
+
+    root.add({"dmadebugger", "timeline"},
+             "command", "Records the DMA slot allocation of a single frame");
+
+    root.add({"dmadebugger", "timeline", "record"},
+             "command", "Records the next frame or the specified frame",
+             &RetroShell::exec <Token::dmadebugger, Token::timeline, Token::record>, {0, 1});
+
+    root.add({"dmadebugger", "timeline", "info"},
+             "command", "Displays the state of the recorder",
+             &RetroShell::exec <Token::dmadebugger, Token::timeline, Token::info>, 0);
+
+    root.add({"dmadebugger", "timeline", "save"},
+             "command", "Exports the recorded frame (binary or PPM)",
+             &RetroShell::exec <Token::dmadebugger, Token::timeline, Token::save>, 1);
+
     
     //
     // Monitor
@@ -1346,6 +1480,21 @@ Interpreter::registerInstructions()
              "command", "Pauses emulation on task launch",
              &RetroShell::exec <Token::os, Token::cp>, 1);
 
+    root.add({"os", "profile"},
+             "command", "Records the CPU usage per task");
+
+    root.add({"os", "profile", "start"},
+             "command", "Starts recording",
+             &RetroShell::exec <Token::os, Token::profile, Token::start>, 0);
+
+    root.add({"os", "profile", "stop"},
+             "command", "Stops recording",
+             &RetroShell::exec <Token::os, Token::profile, Token::stop>, 0);
+
+    root.add({"os", "profile", "info"},
+             "command", "Displays the recorded CPU usage",
+             &RetroShell::exec <Token::os, Token::profile, Token::info>, 0);
+
     root.add({"os", "set"},
              "command", "Configures the component");
         
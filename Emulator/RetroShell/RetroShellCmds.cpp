@@ -149,6 +149,12 @@ RetroShell::exec <Token::amiga, Token::set, Token::ntsc> (Arguments& argv, long
     amiga.configure(OPT_VIDEO_FORMAT, NTSC);
 }
 
+template <> void
+RetroShell::exec <Token::amiga, Token::set, Token::adaptive> (Arguments& argv, long param)
+{
+    amiga.configure(OPT_ADAPTIVE_ACCURACY, util::parseBool(argv.front()));
+}
+
 template <> void
 RetroShell::exec <Token::amiga, Token::power, Token::on> (Arguments &argv, long param)
 {
@@ -204,6 +210,12 @@ RetroShell::exec <Token::amiga, Token::inspect, Token::defaults> (Arguments &arg
     dump(amiga, Category::Defaults);
 }
 
+template <> void
+RetroShell::exec <Token::amiga, Token::inspect, Token::footprint> (Arguments &argv, long param)
+{
+    dump(amiga, Category::Footprint);
+}
+
 
 //
 // Memory
@@ -283,6 +295,12 @@ RetroShell::exec <Token::memory, Token::set, Token::raminitpattern> (Arguments&
     amiga.configure(OPT_RAM_INIT_PATTERN, util::parseEnum <RamInitPatternEnum> (argv.front()));
 }
 
+template <> void
+RetroShell::exec <Token::memory, Token::set, Token::stats> (Arguments& argv, long param)
+{
+    amiga.configure(OPT_MEM_STATS, util::parseBool(argv.front()));
+}
+
 template <> void
 RetroShell::exec <Token::memory, Token::inspect, Token::state> (Arguments& argv, long param)
 {
@@ -301,6 +319,79 @@ RetroShell::exec <Token::memory, Token::inspect, Token::checksums> (Arguments& a
     dump(amiga.mem, Category::Checksums);
 }
 
+template <> void
+RetroShell::exec <Token::memory, Token::heatmap, Token::start> (Arguments& argv, long param)
+{
+    amiga.mem.startHeatmap();
+}
+
+template <> void
+RetroShell::exec <Token::memory, Token::heatmap, Token::stop> (Arguments& argv, long param)
+{
+    amiga.mem.stopHeatmap();
+}
+
+template <> void
+RetroShell::exec <Token::memory, Token::heatmap, Token::clear> (Arguments& argv, long param)
+{
+    amiga.mem.heatmap.clear();
+}
+
+template <> void
+RetroShell::exec <Token::memory, Token::heatmap, Token::info> (Arguments& argv, long param)
+{
+    std::stringstream ss;
+    amiga.mem.heatmap.dump(ss);
+
+    *this << ss;
+}
+
+template <> void
+RetroShell::exec <Token::memory, Token::heatmap, Token::save> (Arguments& argv, long param)
+{
+    auto path = argv.front();
+    auto mode = argv.size() > 1 ? argv.back() : "frame";
+
+    if (mode != "frame" && mode != "total") {
+        throw VAError(ERROR_OPT_INVARG, "frame, total");
+    }
+
+    if (util::extractSuffix(path) == "pgm") {
+        amiga.mem.heatmap.exportPGM(path, mode == "total");
+    } else {
+        amiga.mem.heatmap.exportCSV(path, mode == "total");
+    }
+}
+
+template <> void
+RetroShell::exec <Token::memory, Token::histogram, Token::start> (Arguments& argv, long param)
+{
+    amiga.mem.startHistogram();
+}
+
+template <> void
+RetroShell::exec <Token::memory, Token::histogram, Token::stop> (Arguments& argv, long param)
+{
+    amiga.mem.stopHistogram();
+}
+
+template <> void
+RetroShell::exec <Token::memory, Token::histogram, Token::clear> (Arguments& argv, long param)
+{
+    amiga.mem.histogram.clear();
+}
+
+template <> void
+RetroShell::exec <Token::memory, Token::histogram, Token::info> (Arguments& argv, long param)
+{
+    auto count = argv.empty() ? 32 : util::parseNum(argv.front());
+
+    std::stringstream ss;
+    amiga.mem.histogram.dump(ss, count);
+
+    *this << ss;
+}
+
 
 //
 // CPU
@@ -497,6 +588,28 @@ RetroShell::exec <Token::cpu, Token::jump> (Arguments &argv, long param)
     amiga.cpu.jump((u32)value);
 }
 
+template <> void
+RetroShell::exec <Token::cpu, Token::trace, Token::start> (Arguments &argv, long param)
+{
+    auto regs = argv.size() > 1 ? util::parseBool(argv[1]) : false;
+    amiga.cpu.startTracing(argv.front(), regs);
+}
+
+template <> void
+RetroShell::exec <Token::cpu, Token::trace, Token::stop> (Arguments &argv, long param)
+{
+    amiga.cpu.stopTracing();
+}
+
+template <> void
+RetroShell::exec <Token::cpu, Token::trace, Token::info> (Arguments &argv, long param)
+{
+    std::stringstream ss;
+    amiga.cpu.dumpTrace(ss);
+
+    *this << ss;
+}
+
 
 //
 // CIA
@@ -640,6 +753,12 @@ RetroShell::exec <Token::blitter, Token::set, Token::accuracy> (Arguments &argv,
     amiga.configure(OPT_BLITTER_ACCURACY, util::parseNum(argv.front()));
 }
 
+template <> void
+RetroShell::exec <Token::blitter, Token::set, Token::async> (Arguments &argv, long param)
+{
+    amiga.configure(OPT_BLITTER_ASYNC, util::parseBool(argv.front()));
+}
+
 template <> void
 RetroShell::exec <Token::blitter, Token::inspect, Token::state> (Arguments& argv, long param)
 {
@@ -652,6 +771,60 @@ RetroShell::exec <Token::blitter, Token::inspect, Token::registers> (Arguments&
     dump(amiga.agnus.blitter, Category::Registers);
 }
 
+template <> void
+RetroShell::exec <Token::blitter, Token::inspect, Token::stats> (Arguments& argv, long param)
+{
+    dump(amiga.agnus.blitter, Category::Stats);
+}
+
+template <> void
+RetroShell::exec <Token::blitter, Token::trace, Token::start> (Arguments& argv, long param)
+{
+    amiga.agnus.blitter.startTracer();
+}
+
+template <> void
+RetroShell::exec <Token::blitter, Token::trace, Token::stop> (Arguments& argv, long param)
+{
+    amiga.agnus.blitter.stopTracer();
+}
+
+template <> void
+RetroShell::exec <Token::blitter, Token::trace, Token::clear> (Arguments& argv, long param)
+{
+    {   SUSPENDED
+
+        amiga.agnus.blitter.tracer.clear();
+    }
+}
+
+template <> void
+RetroShell::exec <Token::blitter, Token::trace, Token::info> (Arguments& argv, long param)
+{
+    std::stringstream ss;
+
+    {   SUSPENDED
+
+        amiga.agnus.blitter.tracer.dump(ss);
+    }
+    *this << ss;
+}
+
+template <> void
+RetroShell::exec <Token::blitter, Token::trace, Token::save> (Arguments& argv, long param)
+{
+    {   SUSPENDED
+
+        auto path = argv.front();
+
+        if (util::extractSuffix(path) == "csv") {
+            amiga.agnus.blitter.tracer.exportCSV(path);
+        } else {
+            amiga.agnus.blitter.tracer.exportTrace(path);
+        }
+    }
+}
+
 
 //
 // Copper
@@ -937,6 +1110,61 @@ RetroShell::exec <Token::dmadebugger, Token::hide, Token::refresh> (Arguments& a
     amiga.configure(OPT_DMA_DEBUG_CHANNEL, DMA_CHANNEL_REFRESH, false);
 }
 
+template <> void
+RetroShell::exec <Token::dmadebugger, Token::profile, Token::start> (Arguments& argv, long param)
+{
+    amiga.agnus.dmaDebugger.startProfiling();
+}
+
+template <> void
+RetroShell::exec <Token::dmadebugger, Token::profile, Token::stop> (Arguments& argv, long param)
+{
+    amiga.agnus.dmaDebugger.stopProfiling();
+}
+
+template <> void
+RetroShell::exec <Token::dmadebugger, Token::profile, Token::info> (Arguments& argv, long param)
+{
+    std::stringstream ss;
+    amiga.agnus.dmaDebugger.dumpProfile(ss);
+
+    *this << ss;
+}
+
+template <> void
+RetroShell::exec <Token::dmadebugger, Token::profile, Token::save> (Arguments& argv, long param)
+{
+    amiga.agnus.dmaDebugger.exportProfile(argv.front());
+}
+
+template <> void
+RetroShell::exec <Token::dmadebugger, Token::timeline, Token::record> (Arguments& argv, long param)
+{
+    auto frame = argv.empty() ? 0 : util::parseNum(argv.front());
+    amiga.agnus.dmaDebugger.recordTimeline(frame);
+}
+
+template <> void
+RetroShell::exec <Token::dmadebugger, Token::timeline, Token::info> (Arguments& argv, long param)
+{
+    std::stringstream ss;
+    amiga.agnus.dmaDebugger.dumpTimeline(ss);
+
+    *this << ss;
+}
+
+template <> void
+RetroShell::exec <Token::dmadebugger, Token::timeline, Token::save> (Arguments& argv, long param)
+{
+    auto path = argv.front();
+
+    if (util::extractSuffix(path) == "ppm") {
+        amiga.agnus.dmaDebugger.exportTimelinePPM(path);
+    } else {
+        amiga.agnus.dmaDebugger.exportTimeline(path);
+    }
+}
+
 
 //
 // Monitor
@@ -1678,6 +1906,27 @@ RetroShell::exec <Token::os, Token::cp> (Arguments& argv, long param)
     *this << "Waiting for task '" << argv.back() << "' to start...\n";
 }
 
+template <> void
+RetroShell::exec <Token::os, Token::profile, Token::start> (Arguments& argv, long param)
+{
+    osDebugger.startProfiling();
+}
+
+template <> void
+RetroShell::exec <Token::os, Token::profile, Token::stop> (Arguments& argv, long param)
+{
+    osDebugger.stopProfiling();
+}
+
+template <> void
+RetroShell::exec <Token::os, Token::profile, Token::info> (Arguments& argv, long param)
+{
+    std::stringstream ss;
+    osDebugger.dumpProfile(ss);
+
+    *this << ss;
+}
+
 template <> void
 RetroShell::exec <Token::os, Token::set, Token::diagboard> (Arguments& argv, long param)
 {
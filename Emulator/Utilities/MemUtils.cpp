@@ -16,7 +16,16 @@ namespace util {
 
 bool isZero(const u8 *ptr, isize size)
 {
-    for (isize i = 0; i < size; i++) {
+    isize i = 0;
+
+    // Check eight bytes at a time
+    for (; i + 8 <= size; i += 8) {
+
+        u64 word;
+        std::memcpy(&word, ptr + i, 8);
+        if (word) return false;
+    }
+    for (; i < size; i++) {
         if (ptr[i]) return false;
     }
     return true;
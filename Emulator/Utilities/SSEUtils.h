@@ -10,9 +10,79 @@
 #pragma once
 
 #include "Types.h"
+#include <bit>
 
 namespace util {
 
+/* Vector of eight 16-bit words. If the compiler supports GCC vector
+ * extensions, the type maps to a native 128-bit register, i.e., SSE2 on x86,
+ * NEON on ARM, and SIMD128 on WebAssembly. On all other compilers, the vector
+ * is emulated by a plain array.
+ */
+#if defined(__GNUC__) || defined(__clang__)
+
+typedef u16 u16x8 __attribute__((vector_size(16)));
+
+#else
+
+struct u16x8 {
+
+    u16 v[8];
+
+    u16 &operator[](isize i) { return v[i]; }
+    u16 operator[](isize i) const { return v[i]; }
+
+#define U16X8_OP(op) \
+u16x8 operator op(const u16x8 &o) const { \
+u16x8 r; for (isize i = 0; i < 8; i++) r.v[i] = u16(v[i] op o.v[i]); return r; } \
+u16x8 &operator op##=(const u16x8 &o) { *this = *this op o; return *this; }
+
+    U16X8_OP(&)
+    U16X8_OP(|)
+    U16X8_OP(^)
+
+#undef U16X8_OP
+
+    u16x8 operator~() const {
+        u16x8 r; for (isize i = 0; i < 8; i++) r.v[i] = u16(~v[i]); return r; }
+    u16x8 operator<<(int n) const {
+        u16x8 r; for (isize i = 0; i < 8; i++) r.v[i] = u16(v[i] << n); return r; }
+    u16x8 operator>>(int n) const {
+        u16x8 r; for (isize i = 0; i < 8; i++) r.v[i] = u16(v[i] >> n); return r; }
+};
+
+#endif
+
+// Loads or stores a vector (no alignment required)
+inline u16x8 loadU16x8(const void *p) { u16x8 r; std::memcpy(&r, p, sizeof(r)); return r; }
+inline void storeU16x8(void *p, const u16x8 &v) { std::memcpy(p, &v, sizeof(v)); }
+
+// Returns a vector with all elements set to the same value
+inline u16x8 splatU16x8(u16 value)
+{
+    u16x8 r;
+    for (isize i = 0; i < 8; i++) r[i] = value;
+    return r;
+}
+
+// Converts all elements from or to big endian format
+inline u16x8 bigEndianU16x8(const u16x8 &v)
+{
+    if constexpr (std::endian::native == std::endian::big) {
+        return v;
+    } else {
+        return (v << 8) | (v >> 8);
+    }
+}
+
+// Ors all elements together
+inline u16 orU16x8(const u16x8 &v)
+{
+    u16 r = 0;
+    for (isize i = 0; i < 8; i++) r |= v[i];
+    return r;
+}
+
 /* Transposes a 8 x 16 bit matrix using SSE3 extensions.
  *
  *     Input:   A pointer to a u16[8] array.
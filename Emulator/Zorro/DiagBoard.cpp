@@ -45,6 +45,17 @@ DiagBoard::_reset(bool hard)
     }
 }
 
+isize
+DiagBoard::_memoryFootprint() const
+{
+    isize result = rom.bytesize();
+
+    result += isize(tasks.capacity() * sizeof(u32));
+    for (auto &target : targets) result += isize(target.capacity());
+
+    return result;
+}
+
 void
 DiagBoard::resetConfig()
 {
@@ -58,6 +58,7 @@ private:
 private:
     
     void _reset(bool hard) override;
+    isize _memoryFootprint() const override;
     
     template <class T>
     void applyToPersistentItems(T& worker)
@@ -67,6 +67,7 @@ private:
 private:
     
     void _reset(bool hard) override;
+    isize _memoryFootprint() const override { return rom.bytesize(); }
     
     template <class T>
     void applyToPersistentItems(T& worker)
@@ -22,7 +22,7 @@
 // Snapshot version number
 #define SNP_MAJOR 3
 #define SNP_MINOR 0
-#define SNP_SUBMINOR 0
+#define SNP_SUBMINOR 2
 #define SNP_BETA 1
 
 // Uncomment this setting in a release build
@@ -141,6 +141,7 @@ static const int OCSREG_DEBUG    = 0; // General OCS register debugging
 static const int ECSREG_DEBUG    = 0; // Special ECS register debugging
 static const int INVREG_DEBUG    = 0; // Invalid register accesses
 static const int MEM_DEBUG       = 0; // Memory
+static const int MEM_HEATMAP     = 0; // Support the memory access heatmap
 
 // Agnus
 static const int DMA_DEBUG       = 0; // DMA registers